@@ -31,6 +31,8 @@ public:
     Vertex<V, E> * search(const V & );
     Vertex<V, E> * search(const Vertex<V,E> *);
     
+    std::vector< Vertex<V,E> * > * getNodes();
+    
     void getIncidentePorVertex();
     
     template <class Vn, class En>
@@ -133,6 +135,12 @@ Vertex<V, E> * Graph<V,E>::search(const Vertex<V,E> * value )
     return vertex;
 }
 
+template <class V, class E>
+std::vector< Vertex<V,E> * > * Graph<V,E>::getNodes()
+{
+    return &nodes;
+}
+
 template <class V, class E>
 void Graph<V,E>::getIncidentePorVertex()
 {
@@ -0,0 +1,114 @@
+//
+//  GraphIndex.hpp
+//  Graph
+//
+//  Created by Developer on 18/10/26.
+//
+
+#ifndef GraphIndex_hpp
+#define GraphIndex_hpp
+
+#include <vector>
+#include <unordered_map>
+#include "Graph.hpp"
+
+/* Vista compacta de un Graph<V,E>
+ * Asigna a cada vértice un id denso (su posición en el grafo) y a cada arista
+ * un índice global: primero las aristas del vértice 0, luego las del 1, etc.
+ * Los algoritmos trabajan sobre estos arreglos en lugar de seguir apuntadores.
+ * Nota: la vista no se actualiza si el grafo se modifica después de crearla
+ */
+template <class V, class E>
+class GraphIndex {
+    std::vector< Vertex<V,E> * > vertices;
+    std::unordered_map< const Vertex<V,E> *, int > ids;
+
+    std::vector< Edge<V,E> * > edges;
+    std::vector<int> sources;
+    std::vector<int> targets;
+    std::vector<E> weights;
+
+    /* Adyacencia comprimida: salientes por origen y entrantes por destino */
+    std::vector<int> outOffsets;
+    std::vector<int> inOffsets;
+    std::vector<int> inEdges;
+
+public:
+    GraphIndex(Graph<V,E> &);
+
+    int vertexCount() const { return (int) vertices.size(); }
+    int edgeCount() const { return (int) edges.size(); }
+
+    /* Obtener el id de un vértice, -1 si no pertenece al grafo */
+    int id(const Vertex<V,E> *) const;
+
+    Vertex<V,E> * vertex(int id) const { return vertices[id]; }
+    Edge<V,E> * edge(int index) const { return edges[index]; }
+    int source(int index) const { return sources[index]; }
+    int target(int index) const { return targets[index]; }
+    const E & weight(int index) const { return weights[index]; }
+
+    /* Las aristas que salen de v son los índices [firstOut(v), firstOut(v+1)) */
+    int firstOut(int v) const { return outOffsets[v]; }
+
+    /* Las aristas que llegan a v son incoming(i) con i en [firstIn(v), firstIn(v+1)) */
+    int firstIn(int v) const { return inOffsets[v]; }
+    int incoming(int i) const { return inEdges[i]; }
+};
+
+/* Construir la vista
+ * Complejidad: O(V + E)
+ */
+template <class V, class E>
+GraphIndex<V,E>::GraphIndex(Graph<V,E> & graph)
+{
+    vertices = *graph.getNodes();
+    ids.reserve(vertices.size());
+    outOffsets.assign(vertices.size() + 1, 0);
+    inOffsets.assign(vertices.size() + 1, 0);
+
+    /* Asignar ids densos a los vértices */
+    for (int i = 0; i < (int) vertices.size(); ++i) {
+        ids[vertices[i]] = i;
+    }
+
+    /* Aplanar las aristas en el orden del grafo */
+    for (int i = 0; i < (int) vertices.size(); ++i) {
+        for (auto e : *vertices[i]->getEdges()) {
+            edges.push_back(e);
+            sources.push_back(i);
+            targets.push_back(id(e->getTarget()));
+            weights.push_back(e->getInfo());
+        }
+        outOffsets[i+1] = (int) edges.size();
+    }
+
+    /* Agrupar las aristas por destino (ordenamiento por conteo) */
+    for (int t : targets) {
+        if (t >= 0) { ++inOffsets[t+1]; }
+    }
+
+    for (int v = 0; v < (int) vertices.size(); ++v) {
+        inOffsets[v+1] += inOffsets[v];
+    }
+
+    inEdges.resize(inOffsets.back());
+    std::vector<int> next(inOffsets.begin(), inOffsets.end() - 1);
+
+    for (int e = 0; e < (int) edges.size(); ++e) {
+        if (targets[e] >= 0) { inEdges[next[targets[e]]++] = e; }
+    }
+}
+
+/* Obtener el id de un vértice
+ * Complejidad: O(1)
+ */
+template <class V, class E>
+int GraphIndex<V,E>::id(const Vertex<V,E> * vertex) const
+{
+    auto it = ids.find(vertex);
+
+    return it == ids.end() ? -1 : it->second;
+}
+
+#endif /* GraphIndex_hpp */
@@ -0,0 +1,569 @@
+//
+//  PartitionedGraph.hpp
+//  Graph
+//
+//  Created by Developer on 18/10/26.
+//
+
+#ifndef PartitionedGraph_hpp
+#define PartitionedGraph_hpp
+
+#include <vector>
+#include <atomic>
+#include <string>
+#include <cstdint>
+#include <stdexcept>
+#include <functional>
+#include <algorithm>
+#include <new>
+#include <csignal>
+#include <cerrno>
+#include <fcntl.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include "GraphIndex.hpp"
+
+/* Segmento de memoria compartida POSIX
+ * El nombre se elimina justo después de mapearlo: el segmento vive mientras
+ * algún proceso (el padre o los hijos creados con fork) lo tenga mapeado.
+ */
+class SharedSegment {
+    void * address = nullptr;
+    std::size_t length = 0;
+
+public:
+    SharedSegment(std::size_t bytes);
+    ~SharedSegment() { release(); }
+
+    SharedSegment(const SharedSegment &) = delete;
+    SharedSegment & operator =(const SharedSegment &) = delete;
+
+    void * data() const { return address; }
+    std::size_t size() const { return length; }
+
+    /* Desmapear el segmento en este proceso */
+    void release();
+};
+
+inline SharedSegment::SharedSegment(std::size_t bytes) : length(std::max<std::size_t>(bytes, 1))
+{
+    static std::atomic<int> counter(0);
+    std::string name = "/graph-" + std::to_string(getpid()) + "-" + std::to_string(counter++);
+
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        throw std::runtime_error("shm_open failed for " + name);
+    }
+
+    if (ftruncate(fd, (off_t) length) != 0) {
+        close(fd);
+        shm_unlink(name.c_str());
+        throw std::runtime_error("ftruncate failed for " + name);
+    }
+
+    void * mapped = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    shm_unlink(name.c_str());
+
+    if (mapped == MAP_FAILED) {
+        throw std::runtime_error("mmap failed for " + name);
+    }
+
+    address = mapped;
+}
+
+inline void SharedSegment::release()
+{
+    if (address != nullptr) {
+        munmap(address, length);
+        address = nullptr;
+    }
+}
+
+/* Mensaje entre particiones: un vértice destino y un valor */
+struct PartitionMessage {
+    int vertex;
+    double value;
+};
+
+/* Cola circular sin candados de un productor y un consumidor
+ * Vive dentro de un segmento compartido, por eso solo usa atómicos sin candado.
+ */
+class MessageRing {
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+                  "MessageRing needs lock-free 64-bit atomics to live in shared memory");
+
+    alignas(64) std::atomic<std::uint64_t> head;
+    alignas(64) std::atomic<std::uint64_t> tail;
+    std::uint64_t capacity;
+
+    PartitionMessage * slots() { return reinterpret_cast<PartitionMessage *>(this + 1); }
+
+public:
+    MessageRing(std::uint64_t _capacity) : head(0), tail(0), capacity(_capacity) {}
+
+    static std::size_t bytes(std::uint64_t capacity)
+    {
+        return sizeof(MessageRing) + capacity * sizeof(PartitionMessage);
+    }
+
+    /* Encolar; regresa false si la cola está llena */
+    bool push(const PartitionMessage & message)
+    {
+        std::uint64_t t = tail.load(std::memory_order_relaxed);
+        if (t - head.load(std::memory_order_acquire) == capacity) { return false; }
+
+        slots()[t % capacity] = message;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    /* Desencolar; regresa false si la cola está vacía */
+    bool pop(PartitionMessage & message)
+    {
+        std::uint64_t h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire)) { return false; }
+
+        message = slots()[h % capacity];
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+};
+
+/* Barrera entre procesos con inversión de generación */
+struct ProcessBarrier {
+    std::atomic<int> waiting;
+    std::atomic<int> generation;
+    int parties;
+
+    ProcessBarrier(int _parties) : waiting(0), generation(0), parties(_parties) {}
+
+    /* Esperar a los demás procesos ejecutando idle() mientras tanto */
+    void wait(const std::function<void()> & idle)
+    {
+        int gen = generation.load(std::memory_order_acquire);
+
+        if (waiting.fetch_add(1, std::memory_order_acq_rel) + 1 == parties) {
+            waiting.store(0, std::memory_order_relaxed);
+            generation.fetch_add(1, std::memory_order_acq_rel);
+            return;
+        }
+
+        while (generation.load(std::memory_order_acquire) == gen) {
+            if (idle) { idle(); }
+            sched_yield();
+        }
+    }
+};
+
+/* Grafo repartido entre procesos de un mismo equipo
+ * El particionador asigna a cada proceso un rango contiguo de vértices
+ * balanceando vértices + aristas salientes (corte por aristas). Cada partición
+ * guarda su adyacencia en su propio segmento compartido y los procesos solo
+ * intercambian mensajes de frontera por colas sin candados, una por cada par
+ * (origen, destino). Los algoritmos avanzan por superpasos sincronizados.
+ * Nota: usa fork(), así que debe llamarse desde un proceso con un solo hilo
+ */
+template <class V, class E>
+class PartitionedGraph {
+    GraphIndex<V,E> graph;
+    int parts;
+    std::uint64_t ringCapacity;
+
+    /* Vértices de la partición p: [bounds[p], bounds[p+1]) */
+    std::vector<int> bounds;
+    std::vector<SharedSegment *> segments;
+    int cut = 0;
+
+    struct PartitionView {
+        int begin;
+        int end;
+        const long long * offsets;
+        const int * targets;
+    };
+
+    struct Control {
+        ProcessBarrier barrier;
+        std::atomic<long long> discovered[3];
+
+        Control(int parties) : barrier(parties)
+        {
+            for (auto & d : discovered) { d.store(0); }
+        }
+    };
+
+    class Worker;
+
+    PartitionView view(int p) const;
+    void run(const std::function<void(Worker &)> &);
+
+public:
+    PartitionedGraph(Graph<V,E> &, int partitions, std::uint64_t ringCapacity = 1 << 14);
+    ~PartitionedGraph();
+
+    PartitionedGraph(const PartitionedGraph &) = delete;
+    PartitionedGraph & operator =(const PartitionedGraph &) = delete;
+
+    int partitions() const { return parts; }
+
+    /* Cantidad de aristas cuyo destino está en otra partición */
+    int cutEdges() const { return cut; }
+
+    /* Partición dueña del vértice con id v (ver GraphIndex) */
+    int owner(int v) const;
+
+    const GraphIndex<V,E> & index() const { return graph; }
+
+    /* Nivel BFS de cada vértice por id; -1 si no es alcanzable */
+    std::vector<int> bfs(Vertex<V,E> * source);
+
+    /* PageRank de cada vértice por id */
+    std::vector<double> pageRank(int iterations = 20, double damping = 0.85);
+};
+
+/* Estado de un proceso trabajador dentro de una ejecución */
+template <class V, class E>
+class PartitionedGraph<V,E>::Worker {
+public:
+    int id;
+    PartitionView partition;
+    Control * control;
+    const PartitionedGraph<V,E> * parent;
+    std::function<void(const PartitionMessage &)> receive;
+
+private:
+    std::vector<MessageRing *> rings;
+
+public:
+    Worker(int _id, const PartitionedGraph<V,E> * _parent, Control * _control, std::vector<MessageRing *> _rings)
+    : id(_id), partition(_parent->view(_id)), control(_control), parent(_parent), rings(_rings) {}
+
+    MessageRing * ring(int from, int to) { return rings[from * parent->parts + to]; }
+
+    /* Consumir todos los mensajes pendientes dirigidos a este proceso */
+    void drain()
+    {
+        PartitionMessage message;
+
+        for (int from = 0; from < parent->parts; ++from) {
+            if (from == id) { continue; }
+            while (ring(from, id)->pop(message)) { receive(message); }
+        }
+    }
+
+    /* Enviar un mensaje; mientras la cola esté llena se atienden los mensajes
+     * entrantes para que dos procesos nunca se bloqueen mutuamente
+     */
+    void send(int to, const PartitionMessage & message)
+    {
+        while (!ring(id, to)->push(message)) {
+            drain();
+            sched_yield();
+        }
+    }
+
+    /* Cerrar un superpaso: todos los mensajes enviados quedan entregados.
+     * beforeRelease se ejecuta con la entrega completa y antes de que algún
+     * proceso empiece el siguiente superpaso.
+     */
+    void sync(const std::function<void()> & beforeRelease)
+    {
+        control->barrier.wait([this]() { drain(); });
+        drain();
+        if (beforeRelease) { beforeRelease(); }
+        control->barrier.wait(nullptr);
+    }
+};
+
+/* Particionar el grafo y copiar cada partición a su segmento compartido
+ * Complejidad: O(V + E)
+ */
+template <class V, class E>
+PartitionedGraph<V,E>::PartitionedGraph(Graph<V,E> & source, int partitions, std::uint64_t capacity)
+: graph(source), parts(std::max(1, partitions)), ringCapacity(std::max<std::uint64_t>(capacity, 1))
+{
+    int n = graph.vertexCount();
+    long long total = (long long) n + graph.edgeCount();
+    long long accumulated = 0;
+
+    /* Cortar los rangos cuando el peso acumulado alcanza la siguiente fracción */
+    bounds.push_back(0);
+    for (int v = 0; v < n && (int) bounds.size() < parts; ++v) {
+        accumulated += 1 + graph.firstOut(v+1) - graph.firstOut(v);
+        if (accumulated * parts >= total * (long long) bounds.size()) {
+            bounds.push_back(v + 1);
+        }
+    }
+    while ((int) bounds.size() <= parts) { bounds.push_back(n); }
+
+    for (int p = 0; p < parts; ++p) {
+        int begin = bounds[p];
+        int end = bounds[p+1];
+        long long edges = graph.firstOut(end) - graph.firstOut(begin);
+
+        std::size_t bytes = (end - begin + 1) * sizeof(long long) + edges * sizeof(int);
+        SharedSegment * segment = new SharedSegment(bytes);
+        segments.push_back(segment);
+
+        long long * offsets = static_cast<long long *>(segment->data());
+        int * targets = reinterpret_cast<int *>(offsets + (end - begin + 1));
+
+        for (int v = begin; v <= end; ++v) {
+            offsets[v - begin] = graph.firstOut(v) - graph.firstOut(begin);
+        }
+
+        for (int e = graph.firstOut(begin); e < graph.firstOut(end); ++e) {
+            targets[e - graph.firstOut(begin)] = graph.target(e);
+            if (graph.target(e) >= 0 && owner(graph.target(e)) != p) { ++cut; }
+        }
+    }
+}
+
+template <class V, class E>
+PartitionedGraph<V,E>::~PartitionedGraph()
+{
+    for (auto s : segments) {
+        delete s;
+    }
+
+    segments.clear();
+}
+
+template <class V, class E>
+int PartitionedGraph<V,E>::owner(int v) const
+{
+    return (int) (std::upper_bound(bounds.begin(), bounds.end() - 1, v) - bounds.begin()) - 1;
+}
+
+template <class V, class E>
+typename PartitionedGraph<V,E>::PartitionView PartitionedGraph<V,E>::view(int p) const
+{
+    const long long * offsets = static_cast<const long long *>(segments[p]->data());
+    int count = bounds[p+1] - bounds[p];
+
+    return { bounds[p], bounds[p+1], offsets, reinterpret_cast<const int *>(offsets + count + 1) };
+}
+
+/* Crear un proceso por partición y esperar a que todos terminen
+ * Los hijos desmapean las particiones ajenas y salen con _exit para no
+ * ejecutar destructores del proceso padre. Si un hijo falla, los demás se
+ * quedarían esperándolo en la barrera, así que se terminan con SIGKILL.
+ * Nota: waitpid(-1) recoge a cualquier hijo del proceso; los que no son
+ * de esta corrida se ignoran.
+ */
+template <class V, class E>
+void PartitionedGraph<V,E>::run(const std::function<void(Worker &)> & body)
+{
+    SharedSegment controlSegment(sizeof(Control));
+    Control * control = new (controlSegment.data()) Control(parts);
+
+    std::size_t ringBytes = (MessageRing::bytes(ringCapacity) + 63) / 64 * 64;
+    SharedSegment ringSegment(ringBytes * parts * parts);
+    std::vector<MessageRing *> rings;
+
+    for (int i = 0; i < parts * parts; ++i) {
+        char * address = static_cast<char *>(ringSegment.data()) + i * ringBytes;
+        rings.push_back(new (address) MessageRing(ringCapacity));
+    }
+
+    std::vector<pid_t> children;
+
+    for (int p = 0; p < parts; ++p) {
+        pid_t pid = fork();
+
+        if (pid < 0) {
+            for (pid_t child : children) { kill(child, SIGKILL); waitpid(child, nullptr, 0); }
+            throw std::runtime_error("fork failed");
+        }
+
+        if (pid == 0) {
+            int status = 0;
+            try {
+                for (int q = 0; q < parts; ++q) {
+                    if (q != p) { segments[q]->release(); }
+                }
+
+                Worker worker(p, this, control, rings);
+                body(worker);
+            }
+            catch (...) {
+                status = 1;
+            }
+            _exit(status);
+        }
+
+        children.push_back(pid);
+    }
+
+    bool failed = false;
+
+    /* Atender a los hijos en el orden en que terminan para notar el primer fallo */
+    while (!children.empty()) {
+        int status = 0;
+        pid_t pid = waitpid(-1, &status, 0);
+
+        if (pid < 0) {
+            if (errno == EINTR) { continue; }
+            break;
+        }
+
+        auto child = std::find(children.begin(), children.end(), pid);
+        if (child == children.end()) { continue; }
+        children.erase(child);
+
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            failed = true;
+            break;
+        }
+    }
+
+    if (failed) {
+        for (pid_t child : children) { kill(child, SIGKILL); }
+        for (pid_t child : children) { waitpid(child, nullptr, 0); }
+        throw std::runtime_error("partition worker failed");
+    }
+}
+
+/* BFS por niveles repartido entre procesos
+ * Cada superpaso expande la frontera local; los vecinos de otra partición
+ * se envían a su dueño. Termina cuando ningún proceso descubre vértices nuevos.
+ */
+template <class V, class E>
+std::vector<int> PartitionedGraph<V,E>::bfs(Vertex<V,E> * source)
+{
+    int n = graph.vertexCount();
+    int s = graph.id(source);
+
+    std::vector<int> levels(n, -1);
+    if (s < 0) { return levels; }
+
+    SharedSegment result(n * sizeof(int));
+    int * shared = static_cast<int *>(result.data());
+
+    run([&](Worker & w) {
+        PartitionView & part = w.partition;
+        std::vector<int> level(part.end - part.begin, -1);
+        std::vector<int> frontier;
+        std::vector<int> next;
+        long long found = 0;
+        int depth = 0;
+
+        auto discover = [&](int v) {
+            if (level[v - part.begin] == -1) {
+                level[v - part.begin] = depth + 1;
+                next.push_back(v);
+                ++found;
+            }
+        };
+
+        w.receive = [&](const PartitionMessage & message) { discover(message.vertex); };
+
+        if (s >= part.begin && s < part.end) {
+            level[s - part.begin] = 0;
+            frontier.push_back(s);
+        }
+
+        for (;; ++depth) {
+            /* Los contadores rotan entre 3 ranuras: esta ya no la lee nadie */
+            if (w.id == 0) { w.control->discovered[(depth + 1) % 3].store(0); }
+
+            found = 0;
+
+            for (int u : frontier) {
+                for (long long i = part.offsets[u - part.begin]; i < part.offsets[u - part.begin + 1]; ++i) {
+                    int t = part.targets[i];
+                    if (t < 0) { continue; }
+
+                    if (t >= part.begin && t < part.end) { discover(t); }
+                    else { w.send(owner(t), { t, 0 }); }
+                }
+            }
+
+            w.sync([&]() { w.control->discovered[depth % 3].fetch_add(found); });
+
+            if (w.control->discovered[depth % 3].load() == 0) { break; }
+
+            frontier.swap(next);
+            next.clear();
+        }
+
+        std::copy(level.begin(), level.end(), shared + part.begin);
+    });
+
+    std::copy(shared, shared + n, levels.begin());
+
+    return levels;
+}
+
+/* PageRank por empuje repartido entre procesos
+ * Cada proceso reparte el rango de sus vértices entre sus vecinos; las
+ * contribuciones a vértices ajenos viajan como mensajes. La masa de los
+ * vértices sin salidas se reparte entre todos.
+ */
+template <class V, class E>
+std::vector<double> PartitionedGraph<V,E>::pageRank(int iterations, double damping)
+{
+    int n = graph.vertexCount();
+    std::vector<double> ranks(n, 0);
+    if (n == 0) { return ranks; }
+
+    SharedSegment result(n * sizeof(double));
+    SharedSegment danglingSegment(parts * sizeof(double));
+    double * shared = static_cast<double *>(result.data());
+    double * dangling = static_cast<double *>(danglingSegment.data());
+
+    run([&](Worker & w) {
+        PartitionView & part = w.partition;
+        int count = part.end - part.begin;
+        std::vector<double> rank(count, 1.0 / n);
+        std::vector<double> incoming(count, 0);
+
+        w.receive = [&](const PartitionMessage & message) {
+            incoming[message.vertex - part.begin] += message.value;
+        };
+
+        for (int it = 0; it < iterations; ++it) {
+            std::fill(incoming.begin(), incoming.end(), 0.0);
+            double lost = 0;
+
+            for (int u = 0; u < count; ++u) {
+                long long first = part.offsets[u];
+                long long last = part.offsets[u + 1];
+
+                if (first == last) {
+                    lost += rank[u];
+                    continue;
+                }
+
+                double share = rank[u] / (double) (last - first);
+
+                for (long long i = first; i < last; ++i) {
+                    int t = part.targets[i];
+                    if (t < 0) { continue; }
+
+                    if (t >= part.begin && t < part.end) { incoming[t - part.begin] += share; }
+                    else { w.send(owner(t), { t, share }); }
+                }
+            }
+
+            w.sync([&]() { dangling[w.id] = lost; });
+
+            double totalLost = 0;
+            for (int p = 0; p < parts; ++p) { totalLost += dangling[p]; }
+
+            for (int v = 0; v < count; ++v) {
+                rank[v] = (1 - damping) / n + damping * (incoming[v] + totalLost / n);
+            }
+        }
+
+        std::copy(rank.begin(), rank.end(), shared + part.begin);
+    });
+
+    std::copy(shared, shared + n, ranks.begin());
+
+    return ranks;
+}
+
+#endif /* PartitionedGraph_hpp */
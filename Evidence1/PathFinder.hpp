@@ -0,0 +1,297 @@
+//
+//  PathFinder.hpp
+//  Graph
+//
+//  Created by Developer on 18/10/26.
+//
+
+#ifndef PathFinder_hpp
+#define PathFinder_hpp
+
+#include <vector>
+#include <queue>
+#include <limits>
+#include <algorithm>
+#include <functional>
+#include "GraphIndex.hpp"
+
+/* Consultas de camino de un origen a un destino
+ * Las búsquedas avanzan desde ambos extremos y se detienen al encontrarse,
+ * por lo que solo exploran una fracción de los vértices alcanzables.
+ * La vista compacta (con la adyacencia inversa) se construye una sola vez y
+ * se reutiliza en cada consulta; el estado por consulta se invalida con una
+ * marca de versión para no reiniciar arreglos de tamaño V.
+ * Nota: una instancia no debe usarse desde varios hilos a la vez
+ */
+template <class V, class E>
+class PathFinder {
+public:
+    struct Path {
+        bool found = false;
+        std::vector< Vertex<V,E> * > vertices;
+        double distance = 0;
+        int explored = 0;
+    };
+
+    /* Estimación de la distancia entre dos vértices para A* */
+    typedef std::function<double(Vertex<V,E> *, Vertex<V,E> *)> Heuristic;
+
+private:
+    GraphIndex<V,E> index;
+
+    unsigned stamp = 0;
+    std::vector<unsigned> seen[2];
+    std::vector<unsigned> settled[2];
+    std::vector<double> dist[2];
+    std::vector<int> parent[2];
+
+    std::vector<unsigned> potentialSeen;
+    std::vector<double> potentialValue;
+
+    void nextQuery();
+    bool isSeen(int side, int v) const { return seen[side][v] == stamp; }
+    void visit(int side, int v, double d, int edge);
+
+    Path buildPath(int s, int t, int meet);
+    Path search(Vertex<V,E> *, Vertex<V,E> *, const Heuristic *);
+
+public:
+    PathFinder(Graph<V,E> & graph);
+
+    /* Camino con menos aristas (BFS bidireccional) */
+    Path bfs(Vertex<V,E> *, Vertex<V,E> *);
+
+    /* Camino de menor peso (Dijkstra bidireccional); los pesos deben ser >= 0 */
+    Path dijkstra(Vertex<V,E> *, Vertex<V,E> *);
+
+    /* Camino de menor peso guiado por una heurística consistente (A* bidireccional) */
+    Path astar(Vertex<V,E> *, Vertex<V,E> *, const Heuristic &);
+};
+
+template <class V, class E>
+PathFinder<V,E>::PathFinder(Graph<V,E> & graph) : index(graph)
+{
+    int n = index.vertexCount();
+
+    for (int side = 0; side < 2; ++side) {
+        seen[side].assign(n, 0);
+        settled[side].assign(n, 0);
+        dist[side].assign(n, 0);
+        parent[side].assign(n, -1);
+    }
+
+    potentialSeen.assign(n, 0);
+    potentialValue.assign(n, 0);
+}
+
+/* Invalidar el estado de la consulta anterior
+ * Complejidad: O(1) amortizado
+ */
+template <class V, class E>
+void PathFinder<V,E>::nextQuery()
+{
+    if (++stamp == 0) {
+        /* La marca dio la vuelta: reiniciar una vez cada 2^32 consultas */
+        for (int side = 0; side < 2; ++side) {
+            std::fill(seen[side].begin(), seen[side].end(), 0);
+            std::fill(settled[side].begin(), settled[side].end(), 0);
+        }
+        std::fill(potentialSeen.begin(), potentialSeen.end(), 0);
+        stamp = 1;
+    }
+}
+
+template <class V, class E>
+void PathFinder<V,E>::visit(int side, int v, double d, int edge)
+{
+    seen[side][v] = stamp;
+    dist[side][v] = d;
+    parent[side][v] = edge;
+}
+
+/* Unir las dos mitades del camino en el vértice de encuentro */
+template <class V, class E>
+typename PathFinder<V,E>::Path PathFinder<V,E>::buildPath(int s, int t, int meet)
+{
+    Path path;
+
+    if (meet < 0) { return path; }
+
+    path.found = true;
+
+    /* Mitad hacia adelante: de meet regresando hasta s */
+    for (int v = meet; v != s; v = index.source(parent[0][v])) {
+        path.vertices.push_back(index.vertex(v));
+        path.distance += (double) index.weight(parent[0][v]);
+    }
+    path.vertices.push_back(index.vertex(s));
+    std::reverse(path.vertices.begin(), path.vertices.end());
+
+    /* Mitad hacia atrás: de meet avanzando hasta t */
+    for (int v = meet; v != t; v = index.target(parent[1][v])) {
+        path.distance += (double) index.weight(parent[1][v]);
+        path.vertices.push_back(index.vertex(index.target(parent[1][v])));
+    }
+
+    return path;
+}
+
+/* Camino con menos aristas entre source y target
+ * Se expande un nivel completo del frente más pequeño en cada paso.
+ * Complejidad: O(V + E) en el peor caso, mucho menos en la práctica
+ */
+template <class V, class E>
+typename PathFinder<V,E>::Path PathFinder<V,E>::bfs(Vertex<V,E> * source, Vertex<V,E> * target)
+{
+    int s = index.id(source);
+    int t = index.id(target);
+
+    if (s < 0 || t < 0) { return Path(); }
+
+    nextQuery();
+    visit(0, s, 0, -1);
+    visit(1, t, 0, -1);
+
+    std::vector<int> frontier[2] = { { s }, { t } };
+    int explored = 2;
+    int meet = (s == t) ? s : -1;
+    double best = std::numeric_limits<double>::infinity();
+
+    while (meet < 0 && !frontier[0].empty() && !frontier[1].empty()) {
+        int side = frontier[0].size() <= frontier[1].size() ? 0 : 1;
+        std::vector<int> next;
+
+        for (int u : frontier[side]) {
+            int first = side == 0 ? index.firstOut(u) : index.firstIn(u);
+            int last = side == 0 ? index.firstOut(u+1) : index.firstIn(u+1);
+
+            for (int i = first; i < last; ++i) {
+                int e = side == 0 ? i : index.incoming(i);
+                int w = side == 0 ? index.target(e) : index.source(e);
+
+                if (w < 0 || isSeen(side, w)) { continue; }
+
+                visit(side, w, dist[side][u] + 1, e);
+                next.push_back(w);
+                ++explored;
+
+                /* El mejor encuentro de este nivel es el camino más corto */
+                if (isSeen(1 - side, w) && dist[0][w] + dist[1][w] < best) {
+                    best = dist[0][w] + dist[1][w];
+                    meet = w;
+                }
+            }
+        }
+
+        frontier[side].swap(next);
+    }
+
+    Path path = buildPath(s, t, meet);
+    path.explored = explored;
+
+    return path;
+}
+
+template <class V, class E>
+typename PathFinder<V,E>::Path PathFinder<V,E>::dijkstra(Vertex<V,E> * source, Vertex<V,E> * target)
+{
+    return search(source, target, nullptr);
+}
+
+template <class V, class E>
+typename PathFinder<V,E>::Path PathFinder<V,E>::astar(Vertex<V,E> * source, Vertex<V,E> * target,
+                                                       const Heuristic & heuristic)
+{
+    return search(source, target, &heuristic);
+}
+
+/* Dijkstra bidireccional sobre pesos reducidos
+ * Con potencial p(v) = (h(v, t) - h(s, v)) / 2 ambas direcciones usan el mismo
+ * peso reducido w(u,v) - p(u) + p(v), que es >= 0 si h es consistente, así que
+ * basta el criterio de paro clásico: tope adelante + tope atrás >= mejor camino.
+ * Sin heurística p = 0 y es Dijkstra bidireccional.
+ * Complejidad: O((V + E) log V) en el peor caso
+ */
+template <class V, class E>
+typename PathFinder<V,E>::Path PathFinder<V,E>::search(Vertex<V,E> * source, Vertex<V,E> * target,
+                                                        const Heuristic * heuristic)
+{
+    int s = index.id(source);
+    int t = index.id(target);
+
+    if (s < 0 || t < 0) { return Path(); }
+
+    nextQuery();
+
+    /* El potencial se calcula una vez por vértice y consulta */
+    auto potential = [&](int v) {
+        if (heuristic == nullptr) { return 0.0; }
+        if (potentialSeen[v] != stamp) {
+            potentialSeen[v] = stamp;
+            potentialValue[v] = ((*heuristic)(index.vertex(v), target) -
+                                 (*heuristic)(source, index.vertex(v))) / 2;
+        }
+        return potentialValue[v];
+    };
+
+    auto reduced = [&](int e) {
+        return (double) index.weight(e) - potential(index.source(e)) + potential(index.target(e));
+    };
+
+    typedef std::pair<double, int> Entry;
+    std::priority_queue< Entry, std::vector<Entry>, std::greater<Entry> > queue[2];
+
+    visit(0, s, 0, -1);
+    visit(1, t, 0, -1);
+    queue[0].push({ 0, s });
+    queue[1].push({ 0, t });
+
+    double best = std::numeric_limits<double>::infinity();
+    int meet = (s == t) ? s : -1;
+    int explored = 0;
+
+    if (s == t) { best = 0; }
+
+    while (!queue[0].empty() && !queue[1].empty()) {
+        if (queue[0].top().first + queue[1].top().first >= best) { break; }
+
+        int side = queue[0].top().first <= queue[1].top().first ? 0 : 1;
+        Entry top = queue[side].top();
+        queue[side].pop();
+
+        int u = top.second;
+        if (settled[side][u] == stamp || top.first > dist[side][u]) { continue; }
+        settled[side][u] = stamp;
+        ++explored;
+
+        int first = side == 0 ? index.firstOut(u) : index.firstIn(u);
+        int last = side == 0 ? index.firstOut(u+1) : index.firstIn(u+1);
+
+        for (int i = first; i < last; ++i) {
+            int e = side == 0 ? i : index.incoming(i);
+            int w = side == 0 ? index.target(e) : index.source(e);
+
+            if (w < 0) { continue; }
+
+            double d = dist[side][u] + reduced(e);
+
+            if (!isSeen(side, w) || d < dist[side][w]) {
+                visit(side, w, d, e);
+                queue[side].push({ d, w });
+            }
+
+            /* Registrar el mejor camino que pasa por w */
+            if (isSeen(1 - side, w) && dist[side][w] + dist[1 - side][w] < best) {
+                best = dist[side][w] + dist[1 - side][w];
+                meet = w;
+            }
+        }
+    }
+
+    Path path = buildPath(s, t, meet);
+    path.explored = explored;
+
+    return path;
+}
+
+#endif /* PathFinder_hpp */
@@ -0,0 +1,271 @@
+//
+//  SpanningForest.hpp
+//  Graph
+//
+//  Created by Developer on 18/10/26.
+//
+
+#ifndef SpanningForest_hpp
+#define SpanningForest_hpp
+
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <algorithm>
+#include <numeric>
+#include "GraphIndex.hpp"
+
+/* Conjuntos disjuntos (union-find) que admiten uniones concurrentes.
+ * La raíz con el id mayor siempre se cuelga de la de id menor, por lo que
+ * no se necesitan rangos y dos hilos nunca forman un ciclo.
+ */
+class ConcurrentDisjointSet {
+    std::vector< std::atomic<int> > parent;
+
+public:
+    ConcurrentDisjointSet(int n) : parent(n)
+    {
+        for (int i = 0; i < n; ++i) {
+            parent[i].store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /* Obtener el representante de x (con compresión por mitades) */
+    int find(int x)
+    {
+        while (true) {
+            int p = parent[x].load(std::memory_order_relaxed);
+            if (p == x) { return x; }
+
+            int gp = parent[p].load(std::memory_order_relaxed);
+            if (p != gp) {
+                parent[x].compare_exchange_weak(p, gp, std::memory_order_relaxed);
+            }
+            x = gp;
+        }
+    }
+
+    /* Unir los conjuntos de a y b; regresa false si ya estaban unidos */
+    bool unite(int a, int b)
+    {
+        while (true) {
+            a = find(a);
+            b = find(b);
+
+            if (a == b) { return false; }
+            if (a > b) { std::swap(a, b); }
+
+            /* Colgar b de a solo si b sigue siendo raíz */
+            int expected = b;
+            if (parent[b].compare_exchange_strong(expected, a, std::memory_order_acq_rel)) {
+                return true;
+            }
+        }
+    }
+};
+
+/* Ejecutar fn(inicio, fin, hilo) sobre [0, count) repartido entre hilos */
+template <class F>
+void parallelRanges(int count, int threads, F fn)
+{
+    if (threads <= 1 || count < threads) {
+        fn(0, count, 0);
+        return;
+    }
+
+    std::vector<std::thread> workers;
+    int chunk = (count + threads - 1) / threads;
+
+    for (int t = 0; t < threads; ++t) {
+        int begin = std::min(count, t * chunk);
+        int end = std::min(count, begin + chunk);
+        workers.emplace_back(fn, begin, end, t);
+    }
+
+    for (auto & w : workers) {
+        w.join();
+    }
+}
+
+/* Comparar dos aristas por peso, desempatando por índice.
+ * El orden total evita ciclos cuando dos componentes eligen aristas de igual peso.
+ */
+template <class V, class E>
+bool lighterEdge(const GraphIndex<V,E> & index, int a, int b)
+{
+    if (index.weight(a) < index.weight(b)) { return true; }
+    if (index.weight(b) < index.weight(a)) { return false; }
+    return a < b;
+}
+
+/* Bosque generador mínimo con Kruskal secuencial
+ * Complejidad: O(E log E)
+ */
+template <class V, class E>
+std::vector<int> kruskalForest(const GraphIndex<V,E> & index)
+{
+    std::vector<int> order;
+
+    for (int e = 0; e < index.edgeCount(); ++e) {
+        if (index.target(e) >= 0 && index.source(e) != index.target(e)) {
+            order.push_back(e);
+        }
+    }
+
+    std::sort(order.begin(), order.end(),
+              [&index](int a, int b) { return lighterEdge(index, a, b); });
+
+    ConcurrentDisjointSet sets(index.vertexCount());
+    std::vector<int> forest;
+
+    for (int e : order) {
+        if (sets.unite(index.source(e), index.target(e))) {
+            forest.push_back(e);
+        }
+    }
+
+    std::sort(forest.begin(), forest.end());
+
+    return forest;
+}
+
+/* Bosque generador mínimo con Borůvka en paralelo
+ * En cada ronda cada componente elige su arista más ligera y se unen todas.
+ * El número de componentes al menos se reduce a la mitad por ronda.
+ * Complejidad: O(E log V / p) con p hilos
+ */
+template <class V, class E>
+std::vector<int> boruvkaForest(const GraphIndex<V,E> & index, int threads)
+{
+    int n = index.vertexCount();
+
+    ConcurrentDisjointSet sets(n);
+    std::vector< std::atomic<int> > cheapest(n);
+    for (auto & c : cheapest) { c.store(-1, std::memory_order_relaxed); }
+
+    /* Aristas que todavía conectan componentes distintas */
+    std::vector<int> active;
+    for (int e = 0; e < index.edgeCount(); ++e) {
+        if (index.target(e) >= 0 && index.source(e) != index.target(e)) {
+            active.push_back(e);
+        }
+    }
+
+    std::vector< std::vector<int> > chosen(threads);
+    std::vector< std::vector<int> > remaining(threads);
+    std::vector<int> forest;
+
+    /* Proponer e como la arista más ligera de la componente root */
+    auto propose = [&](int root, int e) {
+        int current = cheapest[root].load(std::memory_order_relaxed);
+        while ((current == -1 || lighterEdge(index, e, current)) &&
+               !cheapest[root].compare_exchange_weak(current, e, std::memory_order_relaxed)) { }
+    };
+
+    while (!active.empty()) {
+        /* Elegir la arista más ligera de cada componente */
+        parallelRanges((int) active.size(), threads, [&](int begin, int end, int) {
+            for (int i = begin; i < end; ++i) {
+                int e = active[i];
+                int ru = sets.find(index.source(e));
+                int rv = sets.find(index.target(e));
+                if (ru != rv) {
+                    propose(ru, e);
+                    propose(rv, e);
+                }
+            }
+        });
+
+        /* Unir las componentes; una arista elegida por ambos lados se agrega una vez */
+        parallelRanges(n, threads, [&](int begin, int end, int t) {
+            for (int v = begin; v < end; ++v) {
+                int e = cheapest[v].load(std::memory_order_relaxed);
+                if (e == -1) { continue; }
+
+                cheapest[v].store(-1, std::memory_order_relaxed);
+                if (sets.unite(index.source(e), index.target(e))) {
+                    chosen[t].push_back(e);
+                }
+            }
+        });
+
+        bool progress = false;
+        for (auto & c : chosen) {
+            progress = progress || !c.empty();
+            forest.insert(forest.end(), c.begin(), c.end());
+            c.clear();
+        }
+
+        if (!progress) { break; }
+
+        /* Descartar las aristas que ya quedaron dentro de una componente */
+        parallelRanges((int) active.size(), threads, [&](int begin, int end, int t) {
+            for (int i = begin; i < end; ++i) {
+                int e = active[i];
+                if (sets.find(index.source(e)) != sets.find(index.target(e))) {
+                    remaining[t].push_back(e);
+                }
+            }
+        });
+
+        active.clear();
+        for (auto & r : remaining) {
+            active.insert(active.end(), r.begin(), r.end());
+            r.clear();
+        }
+    }
+
+    std::sort(forest.begin(), forest.end());
+
+    return forest;
+}
+
+/* Obtener los índices (según GraphIndex) de las aristas del bosque generador mínimo
+ * Las aristas se consideran no dirigidas y E debe tener operator <.
+ * threads <= 0 usa todos los núcleos; con menos de kruskalThreshold aristas
+ * se usa Kruskal secuencial, que es más rápido en grafos pequeños.
+ */
+template <class V, class E>
+std::vector<int> minimumSpanningForestEdges(const GraphIndex<V,E> & index, int threads = 0,
+                                            int kruskalThreshold = 100000)
+{
+    if (threads <= 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    if (threads == 1 || index.edgeCount() < kruskalThreshold) {
+        return kruskalForest(index);
+    }
+
+    return boruvkaForest(index, threads);
+}
+
+/* Obtener el bosque generador mínimo como un grafo nuevo
+ * El grafo resultante tiene una copia de cada vértice y las aristas del bosque
+ * con su dirección original. El llamador es dueño del grafo regresado.
+ */
+template <class V, class E>
+Graph<V,E> * minimumSpanningForest(Graph<V,E> & graph, int threads = 0,
+                                   int kruskalThreshold = 100000)
+{
+    GraphIndex<V,E> index(graph);
+
+    std::vector<int> forest = minimumSpanningForestEdges(index, threads, kruskalThreshold);
+
+    Graph<V,E> * result = new Graph<V,E>();
+    std::vector< Vertex<V,E> * > copies(index.vertexCount());
+
+    for (int v = 0; v < index.vertexCount(); ++v) {
+        copies[v] = new Vertex<V,E>(index.vertex(v)->getInfo());
+        result->addVertex(copies[v]);
+    }
+
+    /* Se agregan directamente al vértice para evitar la búsqueda lineal de addEdge */
+    for (int e : forest) {
+        copies[index.source(e)]->addEdge(new Edge<V,E>(index.weight(e), copies[index.target(e)]));
+    }
+
+    return result;
+}
+
+#endif /* SpanningForest_hpp */
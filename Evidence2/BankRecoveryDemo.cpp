@@ -0,0 +1,218 @@
+//
+//  BankRecoveryDemo.cpp
+//  BankSystem
+//
+//  Created by Developer on 18/10/26.
+//
+//  Crash test for the durable BankSystem. Each round forks a worker that
+//  runs transfers, month-end maintenance and checkpoints against a bank
+//  stored in the given directory, and kills it with SIGKILL at a random
+//  moment. A fresh process then recovers the bank and checks that every
+//  balance matches its own ledger rows and that no acknowledged transfer
+//  was lost.
+//
+//  Build: g++ -std=c++17 -O2 -pthread BankRecoveryDemo.cpp -o BankRecoveryDemo
+//  Usage: BankRecoveryDemo <empty directory> [rounds = 20]
+//  Returns 1 if a recovery fails or loses an acknowledged transfer.
+//
+
+#include <poll.h>
+#include <signal.h>
+#include <sys/wait.h>
+
+// BankSystem.hpp carries its own demo; keep it out of the way
+#define main bankSystemDemo
+#include "BankSystem.hpp"
+#undef main
+
+namespace {
+    const int AccountCount = 32;
+    const double InitialBalance = 1000000.0;    // fees never drain an account
+    const int WorkerThreads = 4;
+
+    // Open the bank in `directory`, creating the customers and accounts on first use
+    bool openBank(BankSystem& bank, const std::string& directory, size_t checkpointBytes) {
+        if (!bank.enableDurability(directory, checkpointBytes)) return false;
+        if (bank.findAccount(1)) return true;
+
+        for (int i = 1; i <= AccountCount; ++i) {
+            bank.addCustomer(std::unique_ptr<Customer>(new Customer("Test", "Customer", "test@bank", "555")));
+            bank.addAccount(std::unique_ptr<Account>(new Account(AccountType::SAVINGS, i, InitialBalance)));
+        }
+        return true;
+    }
+
+    // Runs until killed; writes one byte to `acks` per transfer that returned true
+    void runWorker(const std::string& directory, int round, int acks) {
+        if (!std::freopen("/dev/null", "w", stdout)) return;    // maintenance prints progress
+
+        BankSystem bank("Recovery", "001");
+        if (!openBank(bank, directory, 0)) {
+            std::cerr << "worker: recovery failed" << std::endl;
+            return;
+        }
+
+        std::vector<std::thread> pool;
+        for (int t = 0; t < WorkerThreads; ++t) {
+            pool.emplace_back([&bank, acks, round, t]() {
+                std::mt19937 random(static_cast<unsigned>(round * WorkerThreads + t));
+                while (true) {
+                    int from = static_cast<int>(random() % AccountCount) + 1;
+                    int to = static_cast<int>(random() % AccountCount) + 1;
+                    double amount = 1.0 + random() % 20;
+                    if (bank.transferBetweenAccounts(from, to, amount)) {
+                        char ack = 1;
+                        if (::write(acks, &ack, 1) != 1) return;
+                    }
+                }
+            });
+        }
+
+        // Checkpoint often, so the kill lands inside one now and then
+        for (int step = 1; ; ++step) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            if (step % 5 == 0) bank.processMonthlyMaintenance();
+            bank.checkpoint();
+        }
+    }
+
+    // Recover the bank and count its transfers; false if it is inconsistent
+    bool verify(const std::string& directory, long& transfers) {
+        BankSystem bank("Recovery", "001");
+        if (!openBank(bank, directory, 0)) {
+            std::cerr << "recovery failed" << std::endl;
+            return false;
+        }
+
+        const Ledger& ledger = Ledger::instance();
+        for (int id = 1; id <= AccountCount; ++id) {
+            Account* account = bank.findAccount(id);
+            if (!account) {
+                std::cerr << "account " << id << " missing" << std::endl;
+                return false;
+            }
+
+            // Replaying the account's own rows must give its balance
+            double expected = InitialBalance;
+            for (int row : account->getTransactionIds()) {
+                double amount = ledger.getAmount(row);
+                switch (ledger.getType(row)) {
+                    case TransactionType::DEPOSIT: expected += amount; break;
+                    case TransactionType::WITHDRAWAL:
+                    case TransactionType::PAYMENT:
+                    case TransactionType::FEE: expected -= amount; break;
+                    case TransactionType::INTEREST: expected += (ledger.getToAccountId(row) == id) ? amount : -amount; break;
+                    case TransactionType::TRANSFER: break;
+                }
+            }
+            if (std::fabs(expected - account->getBalance()) > 1e-6) {
+                std::cerr << "account " << id << ": balance " << account->getBalance()
+                          << ", rows add up to " << expected << std::endl;
+                return false;
+            }
+        }
+
+        transfers = 0;
+        for (size_t row = 1; row <= ledger.size(); ++row) {
+            if (ledger.getType(static_cast<int>(row)) == TransactionType::TRANSFER) transfers++;
+        }
+        return true;
+    }
+
+    // Run verify in a child process, since the Ledger can be recovered once per process
+    bool verifyInChild(const std::string& directory, long& transfers) {
+        int channel[2];
+        if (::pipe(channel) != 0) return false;
+
+        pid_t child = ::fork();
+        if (child == 0) {
+            ::close(channel[0]);
+            long count = 0;
+            bool ok = verify(directory, count);
+            ssize_t written = ::write(channel[1], &count, sizeof(count));
+            std::_Exit((ok && written == sizeof(count)) ? 0 : 1);
+        }
+
+        ::close(channel[1]);
+        bool received = ::read(channel[0], &transfers, sizeof(transfers)) == sizeof(transfers);
+        ::close(channel[0]);
+
+        int status = 0;
+        ::waitpid(child, &status, 0);
+        return received && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    }
+
+    // Start a worker, kill it after `lifetime` and return how many transfers it acknowledged
+    long crashWorker(const std::string& directory, int round, std::chrono::milliseconds lifetime) {
+        int channel[2];
+        if (::pipe(channel) != 0) return -1;
+
+        pid_t child = ::fork();
+        if (child == 0) {
+            ::close(channel[0]);
+            runWorker(directory, round, channel[1]);
+            std::_Exit(1);
+        }
+        ::close(channel[1]);
+
+        // Keep draining the pipe so the worker never blocks on it
+        long acknowledged = 0;
+        char buffer[4096];
+        auto deadline = std::chrono::steady_clock::now() + lifetime;
+        while (true) {
+            auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+            if (left.count() <= 0) break;
+
+            pollfd ready = { channel[0], POLLIN, 0 };
+            if (::poll(&ready, 1, static_cast<int>(left.count())) > 0) {
+                ssize_t count = ::read(channel[0], buffer, sizeof(buffer));
+                if (count <= 0) break;    // the worker died on its own
+                acknowledged += count;
+            }
+        }
+
+        ::kill(child, SIGKILL);
+        ::waitpid(child, nullptr, 0);
+        for (ssize_t count; (count = ::read(channel[0], buffer, sizeof(buffer))) > 0; ) {
+            acknowledged += count;
+        }
+        ::close(channel[0]);
+        return acknowledged;
+    }
+}
+
+int main(int argc, const char * argv[])
+{
+    if (argc < 2) {
+        std::cerr << "usage: BankRecoveryDemo <empty directory> [rounds]" << std::endl;
+        return 2;
+    }
+    std::string directory = argv[1];
+    int rounds = argc > 2 ? std::atoi(argv[2]) : 20;
+
+    long transfers = 0;
+    if (!verifyInChild(directory, transfers)) return 1;
+
+    std::mt19937 random(12345);
+    for (int round = 1; round <= rounds; ++round) {
+        std::chrono::milliseconds lifetime(50 + random() % 400);
+        long acknowledged = crashWorker(directory, round, lifetime);
+
+        long recovered = 0;
+        if (acknowledged < 0 || !verifyInChild(directory, recovered)) {
+            std::cout << "round " << round << ": recovery FAILED" << std::endl;
+            return 1;
+        }
+
+        // Transfers in flight at the kill may or may not have reached the disk
+        bool kept = recovered >= transfers + acknowledged;
+        std::cout << "round " << round << ": killed after " << lifetime.count() << " ms, "
+                  << acknowledged << " acknowledged, " << recovered - transfers << " recovered"
+                  << (kept ? "" : "  LOST TRANSFERS") << std::endl;
+        if (!kept) return 1;
+        transfers = recovered;
+    }
+
+    std::cout << "all " << rounds << " rounds recovered consistently" << std::endl;
+    return 0;
+}
@@ -0,0 +1,184 @@
+//
+//  HazardPointers.hpp
+//  LinkedList
+//
+//  Created by Developer on 18/10/26.
+//
+
+#ifndef HazardPointers_hpp
+#define HazardPointers_hpp
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+/* Apuntadores de riesgo (hazard pointers) para las estructuras sin candados
+ * Antes de leer un nodo compartido, un hilo lo publica en una de sus ranuras;
+ * un nodo retirado solo se libera cuando ninguna ranura lo apunta. Así nadie
+ * libera memoria que otro hilo está leyendo y no hay problema ABA.
+ * Cada hilo toma un registro la primera vez que lo necesita y lo devuelve al
+ * terminar; sus retirados pasan a una lista global que adopta el siguiente
+ * hilo que revise. Al terminar no se libera nada, porque el deleter puede
+ * usar un pool por hilo que ya se destruyó.
+ */
+class HazardPointers {
+public:
+    static const int MaxThreads = 128;
+    static const int SlotsPerThread = 2;
+
+private:
+    struct Record {
+        std::atomic<bool> active { false };
+        std::atomic<void *> slots[SlotsPerThread] = {};
+    };
+
+    struct Retired {
+        void * pointer;
+        void (*deleter)(void *);
+    };
+
+    /* Nodos retirados que dejaron los hilos que ya terminaron */
+    struct Orphans {
+        std::mutex mutex;
+        std::vector<Retired> retired;
+    };
+
+    /* Registro y lista de retirados del hilo actual */
+    class Owner {
+    public:
+        Record * record = nullptr;
+        std::vector<Retired> retired;
+
+        Owner()
+        {
+            for (int i = 0; i < MaxThreads; ++i) {
+                bool expected = false;
+                if (records()[i].active.compare_exchange_strong(expected, true)) {
+                    record = &records()[i];
+                    return;
+                }
+            }
+            throw std::length_error("HazardPointers: demasiados hilos");
+        }
+
+        ~Owner()
+        {
+            for (auto & slot : record->slots) { slot.store(nullptr); }
+
+            if (!retired.empty()) {
+                Orphans & o = orphans();
+                std::lock_guard<std::mutex> lock(o.mutex);
+                o.retired.insert(o.retired.end(), retired.begin(), retired.end());
+            }
+
+            record->active.store(false);
+        }
+    };
+
+    static Record * records()
+    {
+        static Record table[MaxThreads];
+        return table;
+    }
+
+    static Orphans & orphans()
+    {
+        static Orphans * shared = new Orphans();
+        return *shared;
+    }
+
+    static Owner & owner()
+    {
+        thread_local Owner current;
+        return current;
+    }
+
+    /* Liberar los retirados que ya no están protegidos
+     * Complejidad: O(R log H), R retirados y H ranuras
+     */
+    static void scan(Owner & current)
+    {
+        /* Adoptar los retirados de hilos que terminaron */
+        {
+            Orphans & o = orphans();
+            std::unique_lock<std::mutex> lock(o.mutex, std::try_to_lock);
+            if (lock.owns_lock() && !o.retired.empty()) {
+                current.retired.insert(current.retired.end(), o.retired.begin(), o.retired.end());
+                o.retired.clear();
+            }
+        }
+
+        std::vector<void *> hazards;
+        hazards.reserve(MaxThreads * SlotsPerThread);
+
+        for (int i = 0; i < MaxThreads; ++i) {
+            for (auto & slot : records()[i].slots) {
+                void * p = slot.load();
+                if (p != nullptr) { hazards.push_back(p); }
+            }
+        }
+
+        std::sort(hazards.begin(), hazards.end());
+
+        std::vector<Retired> keep;
+
+        for (const Retired & r : current.retired) {
+            if (std::binary_search(hazards.begin(), hazards.end(), r.pointer)) { keep.push_back(r); }
+            else { r.deleter(r.pointer); }
+        }
+
+        current.retired.swap(keep);
+    }
+
+    static void defer(const Retired & retired)
+    {
+        Owner & current = owner();
+
+        current.retired.push_back(retired);
+
+        /* Revisar cuando hay el doble de retirados que de ranuras */
+        if ((int) current.retired.size() >= 2 * MaxThreads * SlotsPerThread) {
+            scan(current);
+        }
+    }
+
+public:
+    /* Leer source y publicarlo en la ranura i hasta que la lectura sea estable */
+    template <class P>
+    static P * protect(int i, const std::atomic<P *> & source)
+    {
+        std::atomic<void *> & slot = owner().record->slots[i];
+        P * p = source.load();
+
+        while (true) {
+            slot.store(p);
+            P * again = source.load();
+            if (again == p) { return p; }
+            p = again;
+        }
+    }
+
+    /* Dejar de proteger la ranura i */
+    static void clear(int i)
+    {
+        owner().record->slots[i].store(nullptr);
+    }
+
+    /* Retirar un nodo; se libera con delete cuando nadie lo proteja */
+    template <class P>
+    static void retire(P * pointer)
+    {
+        defer({ pointer, [](void * p) { delete static_cast<P *>(p); } });
+    }
+
+    /* Retirar un nodo que se libera con Policy::destroy (una política de reserva) */
+    template <class Policy, class P>
+    static void retire(P * pointer)
+    {
+        defer({ pointer, [](void * p) { Policy::destroy(static_cast<P *>(p)); } });
+    }
+};
+
+#endif /* HazardPointers_hpp */
@@ -0,0 +1,617 @@
+//
+//  IndexableSkipList.hpp
+//  LinkedList
+//
+//  Created by Developer on 18/10/26.
+//
+
+#ifndef IndexableSkipList_hpp
+#define IndexableSkipList_hpp
+
+#include <iostream>
+#include <iterator>
+#include <vector>
+#include <initializer_list>
+#include <new>
+#include <cstdint>
+#include <cstddef>
+#include "LinkedList.hpp"
+
+/* Lista indexable sobre una skip list
+ * Cada nodo tiene una torre de enlaces; el enlace del nivel i salta varios
+ * nodos y guarda cuántas posiciones avanza (su ancho). Para llegar a una
+ * posición se baja por la torre sumando anchos, así que at(), insert(pos) y
+ * remove(pos) son O(log n) esperado en lugar de recorrer desde el inicio.
+ * La altura de cada nodo es aleatoria: sube un nivel con probabilidad 1/4.
+ * Igual que UnrolledLinkedList, at() regresa un apuntador al valor y
+ * remove() indica si se eliminó algo.
+ */
+template <class T>
+class IndexableSkipList {
+protected:
+    static const int MaxLevel = 24;
+
+    struct SkipNode;
+
+    /* Enlace de un nivel; si next es nullptr el ancho llega hasta el final */
+    struct Link {
+        SkipNode * next = nullptr;
+        int width = 1;
+    };
+
+    /* Los enlaces se guardan justo después del nodo, uno por nivel */
+    struct alignas(T) alignas(Link) SkipNode {
+        T value;
+        int height;
+
+        SkipNode(const T & _value, int _height) : value(_value), height(_height) {}
+
+        Link * links() { return reinterpret_cast<Link *>(this + 1); }
+        const Link * links() const { return reinterpret_cast<const Link *>(this + 1); }
+    };
+
+    Link _head[MaxLevel];
+    int _level = 1;
+    int _size = 0;
+    std::uint64_t _seed = 0x9E3779B97F4A7C15ull;
+
+    int randomHeight();
+    SkipNode * createNode(const T &, int);
+    void destroyNode(SkipNode *);
+
+    /* Enlaces de un nodo; los de la cabeza si node es nullptr */
+    Link * linksOf(SkipNode * node) { return node == nullptr ? _head : node->links(); }
+
+    /* Llenar update con el predecesor de la posición rank (1 es el primero)
+     * en cada nivel y ranks con la posición de cada predecesor
+     */
+    void findPredecessors(int, Link **, int *);
+
+    /* Obtener el nodo de una posición válida */
+    SkipNode * nodeAt(int);
+
+    /* Construir la lista (vacía) con count valores a partir de from en O(n) */
+    template <class InputIt>
+    void build(InputIt, int);
+
+    /* Iterador sobre los elementos (recorre el nivel 0) */
+    template <class N, class V>
+    class SkipIterator {
+        N * _node = nullptr;
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef V * pointer;
+        typedef V & reference;
+
+        SkipIterator() {}
+        SkipIterator(N * _anode) : _node(_anode) {}
+
+        /* Un iterador mutable se puede usar donde se espera uno constante */
+        operator SkipIterator<const N, const V>() const { return { _node }; }
+
+        reference operator *() const { return _node->value; }
+        pointer operator ->() const { return &_node->value; }
+        SkipIterator & operator ++() { _node = _node->links()[0].next; return *this; }
+        SkipIterator operator ++(int) { SkipIterator tmp = *this; ++*this; return tmp; }
+        bool operator == (const SkipIterator & it) const { return _node == it._node; }
+        bool operator != (const SkipIterator & it) const { return _node != it._node; }
+    };
+
+public:
+    typedef SkipIterator<SkipNode, T> iterator;
+    typedef SkipIterator<const SkipNode, const T> const_iterator;
+
+    /* Constructor */
+    IndexableSkipList() { }
+
+    IndexableSkipList(std::initializer_list<T> values) { this->build(values.begin(), (int) values.size()); }
+
+    /* Las copias se hacen con clone() */
+    IndexableSkipList(const IndexableSkipList &) = delete;
+    IndexableSkipList & operator =(const IndexableSkipList &) = delete;
+
+    /* Destructor */
+    virtual ~IndexableSkipList() { this->clear(); }
+
+    /* Obtener el tamaño de la lista */
+    int size() const { return _size; }
+
+    /* Determinar si la lista está vacía */
+    bool empty() const { return _size == 0; }
+
+    /* Insertar un elemento en una posición dada */
+    void insert(const T &, int);
+
+    /* Insertar un elemento al inicio */
+    void insert_front(const T & value) { this->insert(value, 0); }
+
+    /* Insertar un elemento al final */
+    void insert_back(const T & value) { this->insert(value, _size); }
+
+    /* Eliminar el elemento en una posición; regresa false si no existe */
+    bool remove(int);
+
+    /* Eliminar el primer elemento */
+    bool remove_front() { return this->remove(0); }
+
+    /* Eliminar el último elemento */
+    bool remove_back() { return this->remove(_size - 1); }
+
+    /* Eliminar todos los elementos de la lista y liberar la memoria ocupada */
+    virtual void clear();
+
+    /* Obtener el elemento que se encuentra en una posición, nullptr si no existe */
+    T * at(int);
+
+    /* Obtener la posición de un valor */
+    virtual int index(const T &) const;
+
+    /* Obtener la cantidad de ocurrencias de un elemento */
+    virtual int count(const T &) const;
+
+    /* Mostrar el contenido de la lista */
+    template <typename Tn>
+    friend std::ostream & operator <<(std::ostream &, const IndexableSkipList<Tn> &);
+
+    /* Funciones que utiliza el foreach
+     * Complejidad: O(1)
+     */
+    iterator begin() { return { _head[0].next }; }
+    iterator end() { return { nullptr }; }
+    const_iterator begin() const { return { _head[0].next }; }
+    const_iterator end() const { return { nullptr }; }
+    const_iterator cbegin() const { return { _head[0].next }; }
+    const_iterator cend() const { return { nullptr }; }
+
+    /* Sobrecarga del operador índice */
+    T * operator [](const int position) { return this->at(position); }
+
+    /* Clonar una lista */
+    IndexableSkipList * clone() const;
+
+    /* Eliminar un rango de elementos */
+    void deleteRange(int, int);
+
+    /* Obtener un subconjunto de elementos (se mueven fuera de esta lista) */
+    IndexableSkipList * subList(int, int);
+
+    /* Operaciones de conjuntos con la misma semántica que LinkedList */
+    IndexableSkipList * Union(IndexableSkipList *, SetSemantics = SetSemantics::Set) const;
+    IndexableSkipList * Intersection(IndexableSkipList *, SetSemantics = SetSemantics::Set) const;
+    IndexableSkipList * Except(IndexableSkipList *, SetSemantics = SetSemantics::Set) const;
+
+protected:
+    ValueCounter<T> countValues() const;
+    IndexableSkipList * filter(IndexableSkipList *, SetSemantics, bool) const;
+};
+
+/* Altura aleatoria con distribución geométrica (p = 1/4)
+ * Complejidad: O(1)
+ */
+template <class T>
+int IndexableSkipList<T>::randomHeight()
+{
+    /* xorshift64* */
+    _seed ^= _seed >> 12;
+    _seed ^= _seed << 25;
+    _seed ^= _seed >> 27;
+    std::uint64_t bits = _seed * 0x2545F4914F6CDD1Dull;
+
+    int height = 1;
+    while (height < MaxLevel && (bits & 3) == 0) {
+        ++height;
+        bits >>= 2;
+    }
+
+    return height;
+}
+
+template <class T>
+typename IndexableSkipList<T>::SkipNode * IndexableSkipList<T>::createNode(const T & value, int height)
+{
+    void * memory = ::operator new(sizeof(SkipNode) + height * sizeof(Link));
+    SkipNode * node = new (memory) SkipNode(value, height);
+
+    for (int i = 0; i < height; ++i) {
+        new (node->links() + i) Link();
+    }
+
+    return node;
+}
+
+template <class T>
+void IndexableSkipList<T>::destroyNode(SkipNode * node)
+{
+    node->~SkipNode();
+    ::operator delete(node);
+}
+
+/* Bajar por los niveles hasta el predecesor de rank
+ * Complejidad: O(log n) esperado
+ */
+template <class T>
+void IndexableSkipList<T>::findPredecessors(int rank, Link ** update, int * ranks)
+{
+    SkipNode * node = nullptr;
+    int position = 0;
+
+    for (int i = _level - 1; i >= 0; --i) {
+        Link * links = linksOf(node);
+
+        while (links[i].next != nullptr && position + links[i].width < rank) {
+            position += links[i].width;
+            node = links[i].next;
+            links = node->links();
+        }
+
+        update[i] = links;
+        ranks[i] = position;
+    }
+}
+
+/* Insertar un elemento en una posición dada
+ * Complejidad: O(log n) esperado
+ */
+template <class T>
+void IndexableSkipList<T>::insert(const T & value, int position)
+{
+    if (position < 0) { position = 0; }
+    if (position > _size) { position = _size; }
+
+    /* El nuevo nodo ocupará la posición rank */
+    int rank = position + 1;
+
+    Link * update[MaxLevel];
+    int ranks[MaxLevel];
+
+    int height = this->randomHeight();
+
+    /* Los niveles nuevos empiezan en la cabeza y llegan hasta el final */
+    for (int i = _level; i < height; ++i) {
+        _head[i].next = nullptr;
+        _head[i].width = _size + 1;
+    }
+    if (height > _level) { _level = height; }
+
+    this->findPredecessors(rank, update, ranks);
+
+    SkipNode * node = this->createNode(value, height);
+    Link * links = node->links();
+
+    for (int i = 0; i < _level; ++i) {
+        Link & previous = update[i][i];
+
+        if (i < height) {
+            /* El sucesor se recorre una posición por la inserción */
+            links[i].next = previous.next;
+            links[i].width = ranks[i] + previous.width + 1 - rank;
+            previous.next = node;
+            previous.width = rank - ranks[i];
+        }
+        else {
+            /* El enlace pasa por encima del nodo nuevo */
+            ++previous.width;
+        }
+    }
+
+    ++_size;
+}
+
+/* Eliminar el elemento en la posición dada
+ * Complejidad: O(log n) esperado
+ */
+template <class T>
+bool IndexableSkipList<T>::remove(int position)
+{
+    if (position < 0 || position >= _size) { return false; }
+
+    this->deleteRange(position, position);
+
+    return true;
+}
+
+/* Eliminar un rango de elementos
+ * Cada nivel se reenlaza una sola vez sobre el rango completo.
+ * Complejidad: O(log n + (to - from)) esperado
+ */
+template <class T>
+void IndexableSkipList<T>::deleteRange(int from, int to)
+{
+    if (from < 0 || to >= _size || from > to) { return; }
+
+    int removed = to - from + 1;
+
+    Link * update[MaxLevel];
+    int ranks[MaxLevel];
+
+    this->findPredecessors(from + 1, update, ranks);
+
+    SkipNode * node = update[0][0].next;
+
+    for (int i = 0; i < _level; ++i) {
+        Link & previous = update[i][i];
+
+        /* Saltar los nodos de este nivel que caen en el rango */
+        while (previous.next != nullptr && ranks[i] + previous.width <= to + 1) {
+            Link & skipped = previous.next->links()[i];
+            previous.width += skipped.width;
+            previous.next = skipped.next;
+        }
+
+        previous.width -= removed;
+    }
+
+    /* Liberar los nodos siguiendo el nivel 0, que aún los une */
+    for (int k = 0; k < removed; ++k) {
+        SkipNode * next = node->links()[0].next;
+        this->destroyNode(node);
+        node = next;
+    }
+
+    _size -= removed;
+
+    while (_level > 1 && _head[_level - 1].next == nullptr) { --_level; }
+}
+
+/* Eliminar todos los elementos de la lista y liberar la memoria ocupada
+ * Complejidad: O(n)
+ */
+template <class T>
+void IndexableSkipList<T>::clear()
+{
+    SkipNode * node = _head[0].next;
+
+    while (node != nullptr) {
+        SkipNode * next = node->links()[0].next;
+        this->destroyNode(node);
+        node = next;
+    }
+
+    for (int i = 0; i < MaxLevel; ++i) {
+        _head[i] = Link();
+    }
+
+    _level = 1;
+    _size = 0;
+}
+
+/* Bajar por los niveles sumando anchos hasta la posición
+ * Complejidad: O(log n) esperado
+ */
+template <class T>
+typename IndexableSkipList<T>::SkipNode * IndexableSkipList<T>::nodeAt(int position)
+{
+    int rank = position + 1;
+    SkipNode * node = nullptr;
+    int current = 0;
+
+    for (int i = _level - 1; i >= 0 && current < rank; --i) {
+        Link * links = linksOf(node);
+
+        while (links[i].next != nullptr && current + links[i].width <= rank) {
+            current += links[i].width;
+            node = links[i].next;
+            links = node->links();
+        }
+    }
+
+    return node;
+}
+
+/* Obtener el elemento que se encuentra en una posición
+ * Complejidad: O(log n) esperado
+ */
+template <class T>
+T * IndexableSkipList<T>::at(int position)
+{
+    if (position < 0 || position >= _size) { return nullptr; }
+
+    return &this->nodeAt(position)->value;
+}
+
+/* Obtener la posición de un valor
+ * Complejidad: O(n)
+ */
+template <class T>
+int IndexableSkipList<T>::index(const T & value) const
+{
+    int position = 0;
+
+    for (const T & item : *this) {
+        if (item == value) { return position; }
+        ++position;
+    }
+
+    return -1;
+}
+
+/* Obtener la cantidad de ocurrencias de un elemento
+ * Complejidad: O(n)
+ */
+template <class T>
+int IndexableSkipList<T>::count(const T & value) const
+{
+    int total = 0;
+
+    for (const T & item : *this) {
+        if (item == value) { ++total; }
+    }
+
+    return total;
+}
+
+/* Construir todos los niveles en una pasada
+ * Se recuerda el último enlace de cada nivel y su posición.
+ * Complejidad: O(n) esperado
+ */
+template <class T>
+template <class InputIt>
+void IndexableSkipList<T>::build(InputIt from, int count)
+{
+    Link * tail[MaxLevel];
+    int tailRank[MaxLevel];
+
+    for (int i = 0; i < MaxLevel; ++i) {
+        tail[i] = _head;
+        tailRank[i] = 0;
+    }
+
+    int rank = 0;
+
+    for (; rank < count; ++from) {
+        ++rank;
+
+        int height = this->randomHeight();
+        if (height > _level) { _level = height; }
+
+        SkipNode * node = this->createNode(*from, height);
+
+        for (int i = 0; i < height; ++i) {
+            tail[i][i].next = node;
+            tail[i][i].width = rank - tailRank[i];
+            tail[i] = node->links();
+            tailRank[i] = rank;
+        }
+    }
+
+    /* Los últimos enlaces de cada nivel llegan hasta el final */
+    for (int i = 0; i < _level; ++i) {
+        tail[i][i].next = nullptr;
+        tail[i][i].width = rank + 1 - tailRank[i];
+    }
+
+    _size = rank;
+}
+
+/* Mostrar el contenido de la lista
+ * Complejidad: O(n)
+ */
+template <class T>
+std::ostream & operator <<(std::ostream & os, const IndexableSkipList<T> & list)
+{
+    for (const T & value : list) {
+        os << value << " ";
+    }
+
+    return os;
+}
+
+/* Clonar una lista
+ * Complejidad: O(n) esperado
+ */
+template <class T>
+IndexableSkipList<T> * IndexableSkipList<T>::clone() const
+{
+    IndexableSkipList * list = new IndexableSkipList();
+
+    list->build(this->begin(), _size);
+
+    return list;
+}
+
+/* Mover un rango de elementos a una lista nueva
+ * Complejidad: O(log n + (to - from)) esperado
+ */
+template <class T>
+IndexableSkipList<T> * IndexableSkipList<T>::subList(int from, int to)
+{
+    if (from < 0 || to >= _size || from > to) { return nullptr; }
+
+    IndexableSkipList * list = new IndexableSkipList();
+
+    list->build(iterator(this->nodeAt(from)), to - from + 1);
+    this->deleteRange(from, to);
+
+    return list;
+}
+
+/* Contar las ocurrencias de los valores de la lista
+ * Complejidad: O(n) esperado
+ */
+template <class T>
+ValueCounter<T> IndexableSkipList<T>::countValues() const
+{
+    ValueCounter<T> counter(_size);
+
+    for (const T & value : *this) {
+        counter.add(value);
+    }
+
+    counter.finish();
+
+    return counter;
+}
+
+/* Obtener la unión de dos listas
+ * Complejidad: O(n + m) esperado
+ */
+template <class T>
+IndexableSkipList<T> * IndexableSkipList<T>::Union(IndexableSkipList * listB, SetSemantics semantics) const
+{
+    std::vector<T> values(this->begin(), this->end());
+
+    ValueCounter<T> inB = listB->countValues();
+
+    if (semantics == SetSemantics::Multiset) {
+        for (const T & value : *this) { inB.take(value); }
+
+        for (const T & value : *listB) {
+            if (inB.take(value)) { values.push_back(value); }
+        }
+    }
+    else {
+        ValueCounter<T> inA = this->countValues();
+
+        for (const T & value : *listB) {
+            if (!inA.contains(value) && inB.contains(value)) {
+                values.push_back(value);
+                while (inB.take(value)) { }
+            }
+        }
+    }
+
+    IndexableSkipList * newList = new IndexableSkipList();
+    newList->build(values.begin(), (int) values.size());
+
+    return newList;
+}
+
+/* Intersección (keep = true) o diferencia (keep = false)
+ * Complejidad: O(n + m) esperado
+ */
+template <class T>
+IndexableSkipList<T> * IndexableSkipList<T>::filter(IndexableSkipList * listB, SetSemantics semantics, bool keep) const
+{
+    std::vector<T> values;
+
+    ValueCounter<T> inB = listB->countValues();
+
+    for (const T & value : *this) {
+        bool found = semantics == SetSemantics::Multiset ? inB.take(value) : inB.contains(value);
+        if (found == keep) { values.push_back(value); }
+    }
+
+    IndexableSkipList * newList = new IndexableSkipList();
+    newList->build(values.begin(), (int) values.size());
+
+    return newList;
+}
+
+/* Obtener la intersección de dos listas */
+template <class T>
+IndexableSkipList<T> * IndexableSkipList<T>::Intersection(IndexableSkipList * listB, SetSemantics semantics) const
+{
+    return this->filter(listB, semantics, true);
+}
+
+/* Obtener la diferencia de dos listas */
+template <class T>
+IndexableSkipList<T> * IndexableSkipList<T>::Except(IndexableSkipList * listB, SetSemantics semantics) const
+{
+    return this->filter(listB, semantics, false);
+}
+
+#endif /* IndexableSkipList_hpp */
@@ -0,0 +1,417 @@
+//
+//  IntrusiveList.hpp
+//  LinkedList
+//
+//  Created by Developer on 18/10/26.
+//
+
+#ifndef IntrusiveList_hpp
+#define IntrusiveList_hpp
+
+#include <iostream>
+#include <iterator>
+#include <cstddef>
+
+template <class Tag>
+class IntrusiveListBase;
+
+/* Enlace que un registro hereda para poder estar en una IntrusiveList
+ * Tag distingue los enlaces cuando el registro está en varias listas a la vez:
+ *
+ *     struct ByPriority; struct ByOwner;
+ *     struct Task : ListHook<ByPriority>, ListHook<ByOwner> { ... };
+ *     IntrusiveList<Task, ByPriority> ready;
+ *     IntrusiveList<Task, ByOwner> owned;
+ *
+ * Cada enlace recuerda su lista, así que puede desenlazarse en O(1) sin
+ * conocerla. Al copiar un registro la copia queda sin enlazar, y al destruirlo
+ * se desenlaza solo.
+ */
+template <class Tag = void>
+class ListHook {
+    friend class IntrusiveListBase<Tag>;
+
+    ListHook * _prev = nullptr;
+    ListHook * _next = nullptr;
+    IntrusiveListBase<Tag> * _owner = nullptr;
+
+public:
+    ListHook() { }
+    ListHook(const ListHook &) { }
+    ListHook & operator =(const ListHook &) { return *this; }
+
+    ~ListHook() { this->unlink(); }
+
+    /* Determinar si el registro está en alguna lista con este Tag */
+    bool isLinked() const { return _owner != nullptr; }
+
+    /* Sacar el registro de su lista, si está en una
+     * Complejidad: O(1)
+     */
+    void unlink();
+};
+
+/* Parte de la lista que no depende del tipo del registro
+ * La lista es circular y doblemente enlazada alrededor de un nodo centinela,
+ * así que enlazar y desenlazar nunca revisan casos especiales.
+ */
+template <class Tag>
+class IntrusiveListBase {
+    friend class ListHook<Tag>;
+
+protected:
+    typedef ListHook<Tag> Hook;
+
+    Hook _root;
+    int _size = 0;
+
+    IntrusiveListBase()
+    {
+        _root._prev = &_root;
+        _root._next = &_root;
+    }
+
+    /* El centinela nunca está "enlazado": sus vecinos son la propia lista */
+    static Hook * prev(const Hook * hook) { return hook->_prev; }
+    static Hook * next(const Hook * hook) { return hook->_next; }
+    static IntrusiveListBase * owner(const Hook * hook) { return hook->_owner; }
+
+    /* Enlazar hook antes de position; si ya estaba en otra lista se mueve */
+    void linkBefore(Hook * position, Hook * hook)
+    {
+        if (position == hook) { return; }
+
+        hook->unlink();
+
+        hook->_prev = position->_prev;
+        hook->_next = position;
+        position->_prev->_next = hook;
+        position->_prev = hook;
+        hook->_owner = this;
+
+        ++_size;
+    }
+
+    /* Desenlazar un hook de esta lista */
+    void unlink(Hook * hook)
+    {
+        hook->_prev->_next = hook->_next;
+        hook->_next->_prev = hook->_prev;
+        hook->_prev = nullptr;
+        hook->_next = nullptr;
+        hook->_owner = nullptr;
+
+        --_size;
+    }
+};
+
+template <class Tag>
+void ListHook<Tag>::unlink()
+{
+    if (_owner != nullptr) { _owner->unlink(this); }
+}
+
+/* Lista intrusiva: enlaza directamente los registros, sin crear nodos
+ * T debe heredar de ListHook<Tag>. La lista no es dueña de los registros:
+ * insertar y eliminar solo cambian apuntadores, nunca reservan ni liberan
+ * memoria, y destruir la lista solo desenlaza lo que contenga.
+ * Un registro está a lo más en una lista por cada Tag; insertarlo en otra lo
+ * saca de la anterior.
+ */
+template <class T, class Tag = void>
+class IntrusiveList : public IntrusiveListBase<Tag> {
+    typedef ListHook<Tag> Hook;
+    typedef IntrusiveListBase<Tag> Base;
+
+    static Hook * hookOf(T & record) { return static_cast<Hook *>(&record); }
+    static const Hook * hookOf(const T & record) { return static_cast<const Hook *>(&record); }
+    static T * recordOf(Hook * hook) { return static_cast<T *>(hook); }
+
+    /* Clase Iterator bidireccional; R es T o const T */
+    template <class R>
+    class HookIterator {
+        friend class IntrusiveList;
+
+        Hook * _hook = nullptr;
+
+    public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef R * pointer;
+        typedef R & reference;
+
+        HookIterator() {}
+        HookIterator(Hook * _ahook) : _hook(_ahook) {}
+
+        /* Un iterador mutable se puede usar donde se espera uno constante */
+        operator HookIterator<const T>() const { return { _hook }; }
+
+        reference operator *() const { return *recordOf(_hook); }
+        pointer operator ->() const { return recordOf(_hook); }
+        HookIterator & operator ++() { _hook = Base::next(_hook); return *this; }
+        HookIterator operator ++(int) { HookIterator tmp = *this; ++*this; return tmp; }
+        HookIterator & operator --() { _hook = Base::prev(_hook); return *this; }
+        HookIterator operator --(int) { HookIterator tmp = *this; --*this; return tmp; }
+        bool operator == (const HookIterator & it) const { return _hook == it._hook; }
+        bool operator != (const HookIterator & it) const { return _hook != it._hook; }
+    };
+
+    Hook * root() const { return const_cast<Hook *>(&this->_root); }
+
+public:
+    typedef HookIterator<T> iterator;
+    typedef HookIterator<const T> const_iterator;
+
+    /* Constructor */
+    IntrusiveList() { }
+
+    IntrusiveList(const IntrusiveList &) = delete;
+    IntrusiveList & operator =(const IntrusiveList &) = delete;
+
+    /* Destructor: desenlaza los registros sin destruirlos */
+    ~IntrusiveList() { this->clear(); }
+
+    /* Obtener el tamaño de la lista */
+    int size() const { return this->_size; }
+
+    /* Determinar si la lista está vacía */
+    bool empty() const { return this->_size == 0; }
+
+    /* Obtener el primer y el último registro, nullptr si la lista está vacía */
+    T * first() const { return this->empty() ? nullptr : recordOf(Base::next(root())); }
+    T * last() const { return this->empty() ? nullptr : recordOf(Base::prev(root())); }
+
+    /* Insertar un registro al inicio o al final
+     * Complejidad: O(1)
+     */
+    void insert_front(T & record) { this->linkBefore(Base::next(root()), hookOf(record)); }
+    void insert_back(T & record) { this->linkBefore(root(), hookOf(record)); }
+
+    /* Insertar un registro en una posición dada
+     * Si position <= 0 se inserta al inicio, si position >= size al final
+     * Complejidad: O(1) en los extremos, O(n) cualquier otro caso
+     */
+    void insert(T &, int);
+
+    /* Insertar record antes o después de un registro que ya está en la lista
+     * Complejidad: O(1)
+     */
+    void insert_before(T & position, T & record) { this->linkBefore(hookOf(position), hookOf(record)); }
+    void insert_after(T & position, T & record) { this->linkBefore(Base::next(hookOf(position)), hookOf(record)); }
+
+    /* Eliminar un registro dado; regresa false si no está en esta lista
+     * Complejidad: O(1)
+     */
+    bool remove(T &);
+
+    /* Eliminar el primer o el último registro y regresarlo
+     * Complejidad: O(1)
+     */
+    T * remove_front();
+    T * remove_back();
+
+    /* Desenlazar todos los registros
+     * Complejidad: O(n)
+     */
+    void clear();
+
+    /* Determinar si un registro está en esta lista
+     * Complejidad: O(1)
+     */
+    bool contains(const T & record) const { return Base::owner(hookOf(record)) == this; }
+
+    /* Obtener el registro que se encuentra en una posición, nullptr si no existe */
+    T * at(int) const;
+
+    /* Obtener la posición de un registro, -1 si no está en esta lista */
+    int index(const T &) const;
+
+    /* Invertir la lista
+     * Complejidad: O(n)
+     */
+    void reverse();
+
+    /* Mover todos los registros de other al final de esta lista
+     * Complejidad: O(m) para registrar la nueva lista de cada registro
+     */
+    void append(IntrusiveList & other);
+
+    /* Funciones que utiliza el foreach
+     * Complejidad: O(1)
+     */
+    iterator begin() { return { Base::next(root()) }; }
+    iterator end() { return { root() }; }
+    const_iterator begin() const { return { Base::next(root()) }; }
+    const_iterator end() const { return { root() }; }
+    const_iterator cbegin() const { return { Base::next(root()) }; }
+    const_iterator cend() const { return { root() }; }
+
+    /* Obtener un iterador a un registro que está en la lista
+     * Complejidad: O(1)
+     */
+    iterator iteratorTo(T & record) { return { hookOf(record) }; }
+
+    /* Mostrar el contenido de la lista */
+    template <typename Tn, class Gn>
+    friend std::ostream & operator <<(std::ostream &, const IntrusiveList<Tn, Gn> &);
+};
+
+/* Insertar un registro en una posición dada
+ * Complejidad: O(1) en los extremos, O(n) cualquier otro caso
+ */
+template <class T, class Tag>
+void IntrusiveList<T, Tag>::insert(T & record, int position)
+{
+    /* Si ya estaba en esta lista, position cuenta sin él */
+    hookOf(record)->unlink();
+
+    if (position <= 0 || this->empty()) {
+        this->insert_front(record);
+    }
+    else if (position >= this->_size) {
+        this->insert_back(record);
+    }
+    else {
+        this->insert_before(*this->at(position), record);
+    }
+}
+
+/* Eliminar un registro dado
+ * Complejidad: O(1)
+ */
+template <class T, class Tag>
+bool IntrusiveList<T, Tag>::remove(T & record)
+{
+    if (!this->contains(record)) { return false; }
+
+    Base::unlink(hookOf(record));
+
+    return true;
+}
+
+/* Eliminar el primer registro
+ * Complejidad: O(1)
+ */
+template <class T, class Tag>
+T * IntrusiveList<T, Tag>::remove_front()
+{
+    T * record = this->first();
+
+    if (record != nullptr) { Base::unlink(hookOf(*record)); }
+
+    return record;
+}
+
+/* Eliminar el último registro
+ * Complejidad: O(1), la lista es doblemente enlazada
+ */
+template <class T, class Tag>
+T * IntrusiveList<T, Tag>::remove_back()
+{
+    T * record = this->last();
+
+    if (record != nullptr) { Base::unlink(hookOf(*record)); }
+
+    return record;
+}
+
+/* Desenlazar todos los registros
+ * Complejidad: O(n)
+ */
+template <class T, class Tag>
+void IntrusiveList<T, Tag>::clear()
+{
+    while (!this->empty()) {
+        Base::unlink(Base::next(root()));
+    }
+}
+
+/* Obtener el registro que se encuentra en una posición
+ * Se recorre desde el extremo más cercano.
+ * Complejidad: O(min(position, n - position))
+ */
+template <class T, class Tag>
+T * IntrusiveList<T, Tag>::at(int position) const
+{
+    if (position < 0 || position >= this->_size) { return nullptr; }
+
+    Hook * hook = root();
+
+    if (position < this->_size / 2) {
+        for (int i = 0; i <= position; ++i) { hook = Base::next(hook); }
+    }
+    else {
+        for (int i = this->_size; i > position; --i) { hook = Base::prev(hook); }
+    }
+
+    return recordOf(hook);
+}
+
+/* Obtener la posición de un registro
+ * Complejidad: O(1) si no está en la lista, O(n) si está
+ */
+template <class T, class Tag>
+int IntrusiveList<T, Tag>::index(const T & record) const
+{
+    if (!this->contains(record)) { return -1; }
+
+    int pos = 0;
+
+    for (const T & item : *this) {
+        if (&item == &record) { return pos; }
+        ++pos;
+    }
+
+    return -1;
+}
+
+/* Invertir la lista intercambiando los enlaces de cada registro
+ * Complejidad: O(n)
+ */
+template <class T, class Tag>
+void IntrusiveList<T, Tag>::reverse()
+{
+    if (this->_size < 2) { return; }
+
+    /* Sacar los registros en orden y volver a enlazarlos al inicio */
+    Hook * hook = Base::next(root());
+    int count = this->_size;
+
+    for (int i = 0; i < count; ++i) {
+        Hook * following = Base::next(hook);
+
+        Base::unlink(hook);
+        this->linkBefore(Base::next(root()), hook);
+
+        hook = following;
+    }
+}
+
+/* Mover todos los registros de other al final de esta lista
+ * Complejidad: O(m)
+ */
+template <class T, class Tag>
+void IntrusiveList<T, Tag>::append(IntrusiveList & other)
+{
+    if (&other == this) { return; }
+
+    while (T * record = other.remove_front()) {
+        this->insert_back(*record);
+    }
+}
+
+/* Mostrar el contenido de la lista
+ * Complejidad: O(n)
+ */
+template <class T, class Tag>
+std::ostream & operator <<(std::ostream & os, const IntrusiveList<T, Tag> & list)
+{
+    for (const T & record : list) {
+        os << record << " ";
+    }
+
+    return os;
+}
+
+#endif /* IntrusiveList_hpp */
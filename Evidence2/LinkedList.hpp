@@ -9,32 +9,110 @@
 #define LinkedList_hpp
 
 #include <iostream>
+#include <iterator>
+#include <cstddef>
+#include <utility>
+#include <initializer_list>
 #include "Node.hpp"
+#include "NodePool.hpp"
+#include "ValueCounter.hpp"
+#include "ListIndex.hpp"
 
-template <class T>
+/* Semántica de Union, Intersection y Except
+ * Set: basta con que un valor aparezca en la otra lista (comportamiento original)
+ * Multiset: se respetan las ocurrencias; la unión toma el máximo, la
+ * intersección el mínimo y la diferencia resta las ocurrencias
+ */
+enum class SetSemantics { Set, Multiset };
+
+/* Allocator decide cómo se reservan los nodos: NodeAllocator usa new/delete
+ * (comportamiento original) y PoolNodeAllocator los toma de un pool por hilo.
+ */
+template <class T, class Allocator = NodeAllocator<T>>
 class LinkedList {
 protected:
     Node<T> * _first = nullptr;
+    Node<T> * _last = nullptr;
     int _size = 0;
     
-    /* Clase Iterator */
-    class Iterator {
-        const LinkedList<T> * _data;
-        int _position;
+    /* En modo ordenado las inserciones respetan el orden de operator < */
+    bool _sorted = false;
+    
+    /* Índice auxiliar opcional (valor -> nodos, nodo -> anterior) */
+    ListIndex<T> * _index = nullptr;
+    
+    /* Reconstruir el índice después de re-enlazar varios nodos a la vez */
+    void reindex()
+    {
+        if (this->_index != nullptr) { this->_index->rebuild(this->_first); }
+    }
+    
+    /* Comparar con operator < (solo se usa en modo ordenado) */
+    static bool lessThan(const T & a, const T & b)
+    {
+        if constexpr (is_less_comparable<T>::value) { return a < b; }
+        else { return false; }
+    }
+    
+    /* Obtener el nodo después del cual debe ir value para mantener el orden */
+    Node<T> * sortedPrevious(const T &) const;
+    
+    /* Enlazar un nodo después de previous (al inicio si previous es nullptr) */
+    void linkAfter(Node<T> *, Node<T> *);
+    
+    /* Desenlazar el nodo que sigue a previous (el primero si previous es nullptr) */
+    Node<T> * unlinkAfter(Node<T> *);
+    
+    /* Desenlazar los count nodos que siguen a previous; regresa el primero y
+     * deja en last el último, con su next en nullptr
+     */
+    Node<T> * detachAfter(Node<T> *, int, Node<T> * &);
+    
+    /* Enlazar la cadena first..last de count nodos después de previous */
+    void attachAfter(Node<T> *, Node<T> *, Node<T> *, int);
+    
+    /* Clase Iterator
+     * Guarda un apuntador al nodo actual, por lo que avanzar es O(1).
+     * N es Node<T> para el iterador mutable y const Node<T> para el constante.
+     */
+    template <class N>
+    class NodeIterator {
+        N * _node = nullptr;
         
     public:
-        Iterator( const LinkedList<T> * _adata, int _aposition)
-        : _data(_adata), _position(_aposition) {}
+        typedef std::forward_iterator_tag iterator_category;
+        typedef Node<T> value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef N * pointer;
+        typedef N & reference;
+        
+        NodeIterator() {}
+        NodeIterator(N * _anode) : _node(_anode) {}
         
-        Node<T> operator *() const { return *(_data->at(_position)); }
-        const  Iterator & operator ++() { ++_position; return *this; }
-        bool operator != (const Iterator & it) const { return _position != it._position; }
+        /* Un iterador mutable se puede usar donde se espera uno constante */
+        operator NodeIterator<const Node<T>>() const { return { _node }; }
+        
+        reference operator *() const { return *_node; }
+        pointer operator ->() const { return _node; }
+        NodeIterator & operator ++() { _node = _node->getNext(); return *this; }
+        NodeIterator operator ++(int) { NodeIterator tmp = *this; _node = _node->getNext(); return tmp; }
+        bool operator == (const NodeIterator & it) const { return _node == it._node; }
+        bool operator != (const NodeIterator & it) const { return _node != it._node; }
     };
     
 public:
+    typedef NodeIterator< Node<T> > iterator;
+    typedef NodeIterator< const Node<T> > const_iterator;
+    
     /* Constructor */
     LinkedList() { };
     
+    /* Construir a partir de una lista de valores o de un rango de iteradores */
+    LinkedList(std::initializer_list<T>);
+    
+    template <class InputIt, class = typename std::iterator_traits<InputIt>::iterator_category>
+    LinkedList(InputIt, InputIt);
+    
     /* Destructor */
     virtual ~LinkedList();
     
@@ -44,23 +122,53 @@ public:
     /* Obtener el primer elemento */
     Node<T> * first() const;
     
+    /* Obtener el último elemento */
+    Node<T> * last() const;
+    
     /* Determinar si la lista está vacía */
     bool empty() const;
     
     /* Insertar un elemento en una posición dada */
     void insert(const T &, int);
+    void insert(T &&, int);
     void insert(Node<T> *, int);
     
     /* Insertar un elemento al inicio */
     void insert_front(const T &);
+    void insert_front(T &&);
     void insert_front(Node<T> *);
 
     /* Insertar un elemento al final */
     void insert_back(const T &);
+    void insert_back(T &&);
     void insert_back(Node<T> *);
     
+    /* Construir un elemento en su lugar con los argumentos de su constructor
+     * y regresar su nodo; no se copia ni se mueve el valor
+     */
+    template <class... Args>
+    Node<T> * emplace(int, Args &&...);
+    
+    template <class... Args>
+    Node<T> * emplace_front(Args &&... args) { return this->emplace(0, std::forward<Args>(args)...); }
+    
+    template <class... Args>
+    Node<T> * emplace_back(Args &&... args) { return this->emplace(this->_size, std::forward<Args>(args)...); }
+    
+    /* Insertar al final todos los elementos de un rango de iteradores */
+    template <class InputIt>
+    void append(InputIt, InputIt);
+    
+    /* Crear un nodo con el Allocator de la lista */
+    static Node<T> * createNode(const T & value) { return Allocator::create(value); }
+    static Node<T> * createNode(T && value) { return Allocator::create(std::move(value)); }
+    
+    /* Liberar un nodo creado con el Allocator de la lista */
+    static void destroyNode(Node<T> * node) { Allocator::destroy(node); }
+    
     /* Eliminar un elemento y regresar un apuntador al mismo.
-     * Nota: No liberan la memoria ocupada por el nodo eliminado
+     * Nota: No liberan la memoria ocupada por el nodo eliminado; con
+     * PoolNodeAllocator debe liberarse con destroyNode y no con delete
      */
     /* Eliminar el elemento en la posición dada */
     Node<T> * remove(int);
@@ -71,7 +179,7 @@ public:
     /* Eliminar el último elemento */
     Node<T> * remove_back();
     
-    /* Eliminar un elemento dado */
+    /* Eliminar un elemento dado; O(1) con el índice activo */
     Node<T> * remove(Node<T> *);
     
     /* Eliminar todos los elementos de la lista y liberar la memoria ocupada */
@@ -87,8 +195,8 @@ public:
     virtual int index(const T &) const;
 
     /* Mostrar el contenido de la lista */
-    template <typename Tn>
-    friend std::ostream & operator <<(std::ostream &, const LinkedList<Tn> &);
+    template <typename Tn, class An>
+    friend std::ostream & operator <<(std::ostream &, const LinkedList<Tn, An> &);
     
     /* Obtener la cantidad de ocurrencias de un elemento */
     virtual int count(const T &) const;
@@ -96,44 +204,212 @@ public:
     /* Invertir una lista */
     virtual void reverse();
     
-    /* Funciones que utiliza el foreach */
-    Iterator begin() const { return { this, 0}; }
-    Iterator end() const { return {this, _size }; }
+    /* Ordenar la lista de forma estable con operator < */
+    void sort();
+    
+    /* Activar o desactivar el modo ordenado; al activarlo se ordena la lista */
+    void setSorted(bool);
+    
+    /* Determinar si la lista está en modo ordenado */
+    bool isSorted() const;
+    
+    /* Activar un índice hash que hace O(1) a count(), a remove(Node *) y a
+     * index() cuando el valor no está; insert y remove lo mantienen al día.
+     * Requiere std::hash<T>. Si se modifica el valor de un nodo con getInfo()
+     * o setInfo() hay que llamar a rebuildIndex().
+     */
+    void enableIndex();
+    
+    /* Desactivar el índice y liberar su memoria */
+    void disableIndex();
+    
+    /* Reconstruir el índice a partir de los valores actuales */
+    void rebuildIndex() { this->reindex(); }
+    
+    /* Determinar si el índice está activo */
+    bool hasIndex() const { return this->_index != nullptr; }
+    
+    /* Funciones que utiliza el foreach
+     * Complejidad: O(1)
+     */
+    iterator begin() { return { _first }; }
+    iterator end() { return { nullptr }; }
+    const_iterator begin() const { return { _first }; }
+    const_iterator end() const { return { nullptr }; }
+    const_iterator cbegin() const { return { _first }; }
+    const_iterator cend() const { return { nullptr }; }
     
     /* Sobrecarga del operador índice */
     Node<T> * operator [](const int);
     
     /* Clonar una lista */
-    LinkedList<T> * clone();
+    LinkedList<T, Allocator> * clone();
     
     /* Eliminar un rango de elementos */
     void deleteRange(int, int);
     
     /* Obtener un subconjunto de elementos de la lista a partir de un rango */
-    LinkedList<T> * subList(int, int);
+    LinkedList<T, Allocator> * subList(int, int);
+    
+    /* Mover los elementos [from, to] de other a esta lista, empezando en position */
+    void splice(int, LinkedList<T, Allocator> &, int, int);
     
     /* Obtener la unión de dos listas */
-    LinkedList<T> * Union(LinkedList<T> * );
+    LinkedList<T, Allocator> * Union(LinkedList<T, Allocator> *, SetSemantics = SetSemantics::Set);
     
     /* Obtener la intersección de dos listas */
-    LinkedList<T> * Intersection(LinkedList<T> * );
+    LinkedList<T, Allocator> * Intersection(LinkedList<T, Allocator> *, SetSemantics = SetSemantics::Set);
     
     /* Obtener la diferencia de dos listas */
-    LinkedList<T> * Except(LinkedList<T> * );
+    LinkedList<T, Allocator> * Except(LinkedList<T, Allocator> *, SetSemantics = SetSemantics::Set);
+    
+protected:
+    /* Versiones por mezcla lineal de las operaciones para listas ordenadas */
+    LinkedList<T, Allocator> * mergeUnion(LinkedList<T, Allocator> *, SetSemantics);
+    LinkedList<T, Allocator> * mergeFilter(LinkedList<T, Allocator> *, SetSemantics, bool);
     
 };
 
-template <class T>
-LinkedList<T>::~LinkedList()
+template <class T, class Allocator>
+LinkedList<T, Allocator>::LinkedList(std::initializer_list<T> values)
+{
+    this->append(values.begin(), values.end());
+}
+
+template <class T, class Allocator>
+template <class InputIt, class>
+LinkedList<T, Allocator>::LinkedList(InputIt from, InputIt to)
+{
+    this->append(from, to);
+}
+
+template <class T, class Allocator>
+LinkedList<T, Allocator>::~LinkedList()
 {
     this->clear();
+    delete this->_index;
+}
+
+/* Enlazar un nodo después de previous
+ * Complejidad: O(1)
+ */
+template <class T, class Allocator>
+void LinkedList<T, Allocator>::linkAfter(Node<T> * previous, Node<T> * node)
+{
+    if (previous == nullptr) {
+        node->setNext(this->_first);
+        this->_first = node;
+    }
+    else {
+        node->setNext(previous->getNext());
+        previous->setNext(node);
+    }
+    
+    /* Si el nodo quedó al final, es el nuevo último */
+    if (node->getNext() == nullptr) {
+        this->_last = node;
+    }
+    
+    if (this->_index != nullptr) { this->_index->linked(previous, node); }
+    
+    ++this->_size;
+}
+
+/* Desenlazar el nodo que sigue a previous
+ * Complejidad: O(1)
+ */
+template <class T, class Allocator>
+Node<T> * LinkedList<T, Allocator>::unlinkAfter(Node<T> * previous)
+{
+    Node<T> * removenode = previous == nullptr ? this->_first : previous->getNext();
+    
+    if (removenode == nullptr) { return nullptr; }
+    
+    if (previous == nullptr) {
+        this->_first = removenode->getNext();
+    }
+    else {
+        previous->setNext(removenode->getNext());
+    }
+    
+    /* Si se eliminó el último, el anterior pasa a ser el último */
+    if (removenode == this->_last) {
+        this->_last = previous;
+    }
+    
+    if (this->_index != nullptr) { this->_index->unlinked(previous, removenode, removenode->getNext()); }
+    
+    removenode->setNext(nullptr);
+    --this->_size;
+    
+    return removenode;
+}
+
+/* Desenlazar una cadena de nodos contiguos
+ * Complejidad: O(count), hay que encontrar el último nodo de la cadena;
+ * O(n) con el índice activo, que se reconstruye
+ */
+template <class T, class Allocator>
+Node<T> * LinkedList<T, Allocator>::detachAfter(Node<T> * previous, int count, Node<T> * & last)
+{
+    Node<T> * first = previous == nullptr ? this->_first : previous->getNext();
+    
+    last = first;
+    for (int i = 1; i < count; ++i) {
+        last = last->getNext();
+    }
+    
+    /* Unir el anterior con lo que sigue a la cadena */
+    if (previous == nullptr) {
+        this->_first = last->getNext();
+    }
+    else {
+        previous->setNext(last->getNext());
+    }
+    
+    if (last == this->_last) {
+        this->_last = previous;
+    }
+    
+    last->setNext(nullptr);
+    this->_size -= count;
+    
+    this->reindex();
+    
+    return first;
+}
+
+/* Enlazar una cadena de nodos contiguos
+ * Complejidad: O(1); O(n) con el índice activo, que se reconstruye
+ */
+template <class T, class Allocator>
+void LinkedList<T, Allocator>::attachAfter(Node<T> * previous, Node<T> * first, Node<T> * last, int count)
+{
+    Node<T> * next = previous == nullptr ? this->_first : previous->getNext();
+    
+    last->setNext(next);
+    
+    if (previous == nullptr) {
+        this->_first = first;
+    }
+    else {
+        previous->setNext(first);
+    }
+    
+    if (next == nullptr) {
+        this->_last = last;
+    }
+    
+    this->_size += count;
+    
+    this->reindex();
 }
 
 /* Obtener el tamaño de la lista
  * Complejidad: O(1)
  */
-template <class T>
-int LinkedList<T>::size() const
+template <class T, class Allocator>
+int LinkedList<T, Allocator>::size() const
 {
     return this->_size;
 }
@@ -141,17 +417,26 @@ int LinkedList<T>::size() const
 /* Obtener el primer elemento
  * Complejidad: O(1)
  */
-template <class T>
-Node<T> * LinkedList<T>::first() const
+template <class T, class Allocator>
+Node<T> * LinkedList<T, Allocator>::first() const
 {
     return this->_first;
 }
 
+/* Obtener el último elemento
+ * Complejidad: O(1)
+ */
+template <class T, class Allocator>
+Node<T> * LinkedList<T, Allocator>::last() const
+{
+    return this->_last;
+}
+
 /* Determinar si la lista está vacía
  * Complejidad: O(1)
  */
-template <class T>
-bool LinkedList<T>::empty() const
+template <class T, class Allocator>
+bool LinkedList<T, Allocator>::empty() const
 {
     return this->_first == nullptr;
 }
@@ -162,136 +447,203 @@ bool LinkedList<T>::empty() const
  * en cualquier otro caso, se inserta en la posición dada
  * Complejidad: O(1) si es al inicio, O(n) cualquier otro caso
  */
-template <class T>
-void LinkedList<T>::insert(const T & value, int position)
+template <class T, class Allocator>
+void LinkedList<T, Allocator>::insert(const T & value, int position)
 {
     /* Crear el nuevo nodo a insertar */
-    Node<T> * newnode = new Node<T>(value);
+    Node<T> * newnode = Allocator::create(value);
+    
+    this->insert(newnode, position);
+}
+
+/* Insertar moviendo el valor al nodo nuevo
+ * Complejidad: O(1) si es al inicio o al final, O(n) cualquier otro caso
+ */
+template <class T, class Allocator>
+void LinkedList<T, Allocator>::insert(T && value, int position)
+{
+    this->insert(Allocator::create(std::move(value)), position);
+}
+
+/* Construir el valor directamente dentro del nodo
+ * Complejidad: O(1) si es al inicio o al final, O(n) cualquier otro caso
+ */
+template <class T, class Allocator>
+template <class... Args>
+Node<T> * LinkedList<T, Allocator>::emplace(int position, Args &&... args)
+{
+    Node<T> * newnode = Allocator::create(std::in_place, std::forward<Args>(args)...);
     
     this->insert(newnode, position);
+    
+    return newnode;
 }
 
-template <class T>
-void LinkedList<T>::insert(Node<T> * node, int position)
+template <class T, class Allocator>
+void LinkedList<T, Allocator>::insert(Node<T> * node, int position)
 {
+    /* En modo ordenado se ignora position y se inserta en su lugar */
+    if (this->_sorted) {
+        this->linkAfter(this->sortedPrevious(node->getInfo()), node);
+    }
     /* Cuando la lista está vacía o position < 0 se inserta al inicio */
-    if (this->empty() || position <= 0) {
-        node->setNext(this->_first);
-        this->_first = node;
+    else if (this->empty() || position <= 0) {
+        this->linkAfter(nullptr, node);
+    }
+    /* Si position >= size se inserta después del último sin recorrer la lista */
+    else if (position >= this->_size) {
+        this->linkAfter(this->_last, node);
     }
-    /* Cuando se inserta en cualquier posición diferente del inicio */
+    /* Cuando se inserta en cualquier otra posición */
     else {
-        
-        /* Si position > size se inserta al final */
-        if (position > this->_size) { position = this->_size; }
-        
         /* Obtener el nodo que está en la posición anterior */
-        Node<T> * previous = this->at(position-1);
-        
-        /* Actualizar apuntadores */
-        node->setNext(previous->getNext());
-        previous->setNext(node);
+        this->linkAfter(this->at(position-1), node);
     }
+}
+
+/* Obtener el nodo después del cual debe ir value en modo ordenado
+ * Se coloca después de los iguales para que la inserción sea estable.
+ * Complejidad: O(1) si va al final, O(n) cualquier otro caso
+ */
+template <class T, class Allocator>
+Node<T> * LinkedList<T, Allocator>::sortedPrevious(const T & value) const
+{
+    /* Va al inicio si es menor que el primero */
+    if (this->empty() || lessThan(value, this->_first->getInfo())) { return nullptr; }
     
-    /* Incrementar el tamaño de la lista */
-    ++this->_size;
+    /* Va al final si no es menor que el último */
+    if (!lessThan(value, this->_last->getInfo())) { return this->_last; }
+    
+    Node<T> * previous = this->_first;
+    
+    while (!lessThan(value, previous->getNext()->getInfo())) {
+        previous = previous->getNext();
+    }
+    
+    return previous;
 }
 
 /* Insertar un elemento al inicio
  * Complejidad: O(1)
  */
-template <class T>
-void LinkedList<T>::insert_front(const T & value)
+template <class T, class Allocator>
+void LinkedList<T, Allocator>::insert_front(const T & value)
 {
     this->insert(value, 0);
 }
 
-template <class T>
-void LinkedList<T>::insert_front(Node<T> * node)
+template <class T, class Allocator>
+void LinkedList<T, Allocator>::insert_front(T && value)
+{
+    this->insert(std::move(value), 0);
+}
+
+template <class T, class Allocator>
+void LinkedList<T, Allocator>::insert_front(Node<T> * node)
 {
     this->insert(node, 0);
 }
 
 /* Insertar un elemento al final
- * Complejidad: O(n)
+ * Complejidad: O(1)
  */
-template <class T>
-void LinkedList<T>::insert_back(const T & value)
+template <class T, class Allocator>
+void LinkedList<T, Allocator>::insert_back(const T & value)
 {
     this->insert(value, this->_size);
 }
 
-template <class T>
-void LinkedList<T>::insert_back(Node<T> * node)
+template <class T, class Allocator>
+void LinkedList<T, Allocator>::insert_back(T && value)
+{
+    this->insert(std::move(value), this->_size);
+}
+
+template <class T, class Allocator>
+void LinkedList<T, Allocator>::insert_back(Node<T> * node)
 {
     this->insert(node, this->_size);
 }
 
-/* Eliminar el elemento en la posición dada
- * Complejidad: O(1) si es al inicio, O(n) cualquier otro caso
+/* Insertar al final todos los elementos de un rango
+ * Complejidad: O(k) con k el tamaño del rango
  */
-/* Eliminar un elemento dado */
-template <class T>
-Node<T> * LinkedList<T>::remove(Node<T> * node)
+template <class T, class Allocator>
+template <class InputIt>
+void LinkedList<T, Allocator>::append(InputIt from, InputIt to)
 {
-    return this->remove( this->index(node) );
+    for (; from != to; ++from) {
+        this->linkAfter(this->_last, Allocator::create(*from));
+    }
+    
+    /* En modo ordenado es más barato ordenar una vez al final */
+    if constexpr (is_less_comparable<T>::value) {
+        if (this->_sorted) { this->sort(); }
+    }
+}
+
+/* Eliminar un elemento dado
+ * Se busca por apuntador, así que con valores repetidos se elimina este nodo
+ * y no el primero con su valor. Regresa nullptr si el nodo no está en la lista.
+ * Complejidad: O(1) esperado con el índice activo, O(n) sin él
+ */
+template <class T, class Allocator>
+Node<T> * LinkedList<T, Allocator>::remove(Node<T> * node)
+{
+    if (this->empty() || node == nullptr) { return nullptr; }
+    
+    Node<T> * previous = nullptr;
+    
+    if (this->_index != nullptr) {
+        if (!this->_index->find(node, previous)) { return nullptr; }
+    }
+    else if (node != this->_first) {
+        /* Buscar el anterior del nodo */
+        previous = this->_first;
+        while (previous != nullptr && previous->getNext() != node) {
+            previous = previous->getNext();
+        }
+        
+        if (previous == nullptr) { return nullptr; }
+    }
+    
+    return this->unlinkAfter(previous);
 }
 
-template <class T>
-Node<T> * LinkedList<T>::remove(int position)
+/* Eliminar el elemento en la posición dada
+ * Complejidad: O(1) si es al inicio, O(n) cualquier otro caso
+ */
+template <class T, class Allocator>
+Node<T> * LinkedList<T, Allocator>::remove(int position)
 {
     /* Cuando la lista está vacía o position es inválida */
     if (this->empty() || (position < 0 || position >= this->_size )) {
         return nullptr;
     }
 
-    /* Declarar variable temporal para guardar el nodo a eliminar */
-    Node<T> * removenode;
-    
     /* Eliminar el primer nodo de la lista */
     if (position == 0) {
-        /* Se guarda el apuntador a first */
-        removenode = this->_first;
-        
-        /* Se actualiza first al siguiente nodo */
-        this->_first = this->_first->getNext();
-        
-    }
-    /* Eliminar cualquier otro nodo */
-    else {
-        /* Se obtiene el apuntador al anterior */
-        Node<T> * previous = this->at(position-1);
-        
-        /* Se guarda el apuntador al nodo a eliminar */
-        removenode = previous->getNext();
-        
-        /* Se actualiza el anterior para que apunte al siguiente nodo */
-        previous->setNext(removenode->getNext());
+        return this->unlinkAfter(nullptr);
     }
-
-    /* Establecer el siguiente en nullptr */
-    removenode->setNext(nullptr);
-    
-    /* Decrementar el tamaño de la lista */
-    --this->_size;
     
-    return removenode;
+    /* Eliminar cualquier otro nodo a partir de su anterior */
+    return this->unlinkAfter(this->at(position-1));
 }
 
 /* Eliminar el primer elemento
  * Complejidad: O(1)
  */
-template <class T>
-Node<T> * LinkedList<T>::remove_front()
+template <class T, class Allocator>
+Node<T> * LinkedList<T, Allocator>::remove_front()
 {
     return this->remove(0);
 }
 
 /* Eliminar el último elemento
- * Complejidad: O(n)
+ * Complejidad: O(n), la lista es simple y hay que encontrar el penúltimo
  */
-template <class T>
-Node<T> * LinkedList<T>::remove_back()
+template <class T, class Allocator>
+Node<T> * LinkedList<T, Allocator>::remove_back()
 {
     return this->remove(this->_size - 1);
 }
@@ -299,39 +651,30 @@ Node<T> * LinkedList<T>::remove_back()
 /* Eliminar todos los elementos de la lista y liberar la memoria ocupada
  * Complejidad: O(n)
  */
-template <class T>
-void LinkedList<T>::clear()
+template <class T, class Allocator>
+void LinkedList<T, Allocator>::clear()
 {
     /* Cuando la lista está vacía */
     if ( this->empty() ) { return; }
     
-    /* Obtener una referencia al primer nodo */
-    Node<T> * tmp = this->_first;
+    /* Liberar toda la cadena de nodos de una vez */
+    Allocator::destroyChain(this->_first);
     
-    /* Desplazarse por la lista e ir eliminando los nodos */
-    while (tmp != nullptr) {
-        /* Mover first al siguiente elemento */
-        this->_first = tmp->getNext();
-        
-        /* Liberar la memoria del nodo */
-        delete tmp;
-        
-        /* Apuntar al primero */
-        tmp = this->_first;
-    }
+    if (this->_index != nullptr) { this->_index->rebuild(nullptr); }
     
     /* Establecer el size en 0 */
     this->_size = 0;
     
-    /* Establecer first en nullptr */
+    /* Establecer first y last en nullptr */
     this->_first = nullptr;
+    this->_last = nullptr;
 }
 
 /* Obtener el nodo que se encuentra en una posición
  * Complejidad: O(n)
  */
-template  <class T>
-Node<T> * LinkedList<T>::at(int position) const
+template <class T, class Allocator>
+Node<T> * LinkedList<T, Allocator>::at(int position) const
 {
     /* Cuando la lista está vacía o position es inválida */
     if (this->empty() || position < 0 || position >= this->_size) {
@@ -354,31 +697,47 @@ Node<T> * LinkedList<T>::at(int position) const
 }
 
 /* Obtener la posición de un nodo
- * Complejidad: O(n)
+ * Se compara por apuntador: con valores repetidos cada nodo tiene su posición.
+ * Complejidad: O(n); O(1) esperado si el índice sabe que no está
  */
-template  <class T>
-int LinkedList<T>::index(Node<T> * node) const
+template <class T, class Allocator>
+int LinkedList<T, Allocator>::index(Node<T> * node) const
 {
     /* Cuando la lista está vacía o node es nullptr */
     if (this->empty() || node == nullptr) {
         return -1;
     }
     
-    /* Buscar el valor del nodo y regresar su posición */
-    return this->index( node->getInfo() );
+    Node<T> * previous;
+    if (this->_index != nullptr && !this->_index->find(node, previous)) {
+        return -1;
+    }
+    
+    int pos = 0;
+    
+    for (Node<T> * tmp = this->_first; tmp != nullptr; tmp = tmp->getNext(), ++pos) {
+        if (tmp == node) { return pos; }
+    }
+    
+    return -1;
 }
 
 /* Obtener la posición de un valor
- * Complejidad: O(n)
+ * Complejidad: O(n); O(1) esperado con el índice activo si el valor no está
  */
-template  <class T>
-int LinkedList<T>::index(const T & value) const
+template <class T, class Allocator>
+int LinkedList<T, Allocator>::index(const T & value) const
 {
     /* Cuando la lista está vacía */
     if ( this->empty() ) {
         return -1;
     }
     
+    /* El índice descarta sin recorrer los valores ausentes */
+    if (this->_index != nullptr && this->_index->count(value) == 0) {
+        return -1;
+    }
+    
     /* Buscar value y regresar su posición */
     int pos = 0;
     
@@ -388,6 +747,9 @@ int LinkedList<T>::index(const T & value) const
     /* Desplazarse por la lista hasta encontrar el value */
     while (tmp != nullptr && tmp->getInfo() != value)
     {
+        /* En modo ordenado ya no puede aparecer después de un valor mayor */
+        if (this->_sorted && lessThan(value, tmp->getInfo())) { return -1; }
+        
         tmp = tmp->getNext();
         ++pos;
     }
@@ -399,11 +761,13 @@ int LinkedList<T>::index(const T & value) const
 }
 
 /* Obtener la cantidad de ocurrencias de un elemento
- * Complejidad: O(n)
+ * Complejidad: O(1) esperado con el índice activo, O(n) sin él
  */
-template  <class T>
-int LinkedList<T>::count(const T & value) const
+template <class T, class Allocator>
+int LinkedList<T, Allocator>::count(const T & value) const
 {
+    if (this->_index != nullptr) { return this->_index->count(value); }
+    
     /* Obtener una referencia al primer elemento */
     Node<T> * tmp = this->_first;
     
@@ -417,6 +781,10 @@ int LinkedList<T>::count(const T & value) const
         if (tmp->getInfo() == value) {
             ++ocurr;
         }
+        /* En modo ordenado las ocurrencias son contiguas */
+        else if (this->_sorted && (ocurr > 0 || lessThan(value, tmp->getInfo()))) {
+            break;
+        }
         
         /* Desplazarse al siguiente elemento */
         tmp = tmp->getNext();
@@ -426,11 +794,17 @@ int LinkedList<T>::count(const T & value) const
 }
 
 /* Invertir una lista
- * Complejidad: O(n)
+ * Complejidad: O(n), también con el índice activo
  */
-template  <class T>
-void LinkedList<T>::reverse()
+template <class T, class Allocator>
+void LinkedList<T, Allocator>::reverse()
 {
+    /* Cuando la lista está vacía no hay nada que invertir */
+    if ( this->empty() ) { return; }
+    
+    /* El primero pasará a ser el último */
+    this->_last = this->_first;
+    
     /* Obtener una referencia al segundo elemento */
     Node<T> * next = this->_first->getNext();
     
@@ -454,13 +828,133 @@ void LinkedList<T>::reverse()
     
     /* Invertir el apuntador next del último nodo para que apunte al nodo anterior */
     this->_first->setNext(previous);
+    
+    /* La lista invertida queda en orden descendente */
+    this->_sorted = false;
+    
+    /* Todos los anteriores cambiaron */
+    this->reindex();
+}
+
+/* Ordenar la lista de forma estable (merge sort ascendente sobre los nodos)
+ * Mezcla corridas de tamaño 1, 2, 4, ... re-enlazando los nodos existentes,
+ * sin copiar valores ni reservar memoria.
+ * Complejidad: O(n log n) en tiempo, O(1) en memoria (más la reconstrucción
+ * del índice si está activo)
+ */
+template <class T, class Allocator>
+void LinkedList<T, Allocator>::sort()
+{
+    static_assert(is_less_comparable<T>::value, "LinkedList::sort requires operator <");
+    
+    if (this->_size < 2) { return; }
+    
+    for (int width = 1; ; width *= 2) {
+        Node<T> * p = this->_first;
+        Node<T> * tail = nullptr;
+        int merges = 0;
+        
+        this->_first = nullptr;
+        
+        while (p != nullptr) {
+            ++merges;
+            
+            /* q apunta al inicio de la segunda corrida */
+            Node<T> * q = p;
+            int psize = 0;
+            while (psize < width && q != nullptr) {
+                ++psize;
+                q = q->getNext();
+            }
+            int qsize = width;
+            
+            /* Mezclar las dos corridas; en empate gana la primera (estable) */
+            while (psize > 0 || (qsize > 0 && q != nullptr)) {
+                Node<T> * e;
+                
+                if (psize == 0) {
+                    e = q; q = q->getNext(); --qsize;
+                }
+                else if (qsize == 0 || q == nullptr || !(q->getInfo() < p->getInfo())) {
+                    e = p; p = p->getNext(); --psize;
+                }
+                else {
+                    e = q; q = q->getNext(); --qsize;
+                }
+                
+                if (tail == nullptr) { this->_first = e; }
+                else { tail->setNext(e); }
+                tail = e;
+            }
+            
+            p = q;
+        }
+        
+        tail->setNext(nullptr);
+        this->_last = tail;
+        
+        /* Una sola mezcla significa que toda la lista quedó ordenada */
+        if (merges <= 1) {
+            this->reindex();
+            return;
+        }
+    }
+}
+
+/* Activar o desactivar el modo ordenado
+ * Complejidad: O(n log n) al activarlo, O(1) al desactivarlo
+ */
+template <class T, class Allocator>
+void LinkedList<T, Allocator>::setSorted(bool sorted)
+{
+    if (sorted && !this->_sorted) {
+        this->sort();
+    }
+    
+    this->_sorted = sorted;
+}
+
+/* Determinar si la lista está en modo ordenado
+ * Complejidad: O(1)
+ */
+template <class T, class Allocator>
+bool LinkedList<T, Allocator>::isSorted() const
+{
+    return this->_sorted;
+}
+
+/* Activar el índice hash
+ * Complejidad: O(n) esperado
+ */
+template <class T, class Allocator>
+void LinkedList<T, Allocator>::enableIndex()
+{
+    static_assert(is_hashable<T>::value, "LinkedList::enableIndex requires std::hash<T>");
+    
+    if constexpr (is_hashable<T>::value) {
+        if (this->_index == nullptr) {
+            this->_index = new HashListIndex<T>();
+        }
+    }
+    
+    this->reindex();
+}
+
+/* Desactivar el índice
+ * Complejidad: O(n)
+ */
+template <class T, class Allocator>
+void LinkedList<T, Allocator>::disableIndex()
+{
+    delete this->_index;
+    this->_index = nullptr;
 }
 
 /* Obtener el elemento de una posición
  * Complejidad: O(n)
  */
-template  <class T>
-Node<T> * LinkedList<T>::operator [](const int position)
+template <class T, class Allocator>
+Node<T> * LinkedList<T, Allocator>::operator [](const int position)
 {
     return this->at(position);
 }
@@ -468,8 +962,8 @@ Node<T> * LinkedList<T>::operator [](const int position)
 /* Mostrar el contenido de la lista
  * Complejidad: O(n)
  */
-template <class T>
-std::ostream & operator <<(std::ostream & os, const LinkedList<T> & list)
+template <class T, class Allocator>
+std::ostream & operator <<(std::ostream & os, const LinkedList<T, Allocator> & list)
 {
     /* Recorrer los elementos con un iterador */
     for (const Node<T> & node : list) {
@@ -482,210 +976,327 @@ std::ostream & operator <<(std::ostream & os, const LinkedList<T> & list)
 /* Clonar una lista
  * Complejidad: O(n)
  */
-template <class T>
-LinkedList<T> * LinkedList<T>::clone()
+template <class T, class Allocator>
+LinkedList<T, Allocator> * LinkedList<T, Allocator>::clone()
 {
     /* Crear una lista vacía */
-    LinkedList<T> * list = new LinkedList<T>();
+    LinkedList<T, Allocator> * list = new LinkedList<T, Allocator>();
     
     /* Obtener una referencia al primer elemento */
     Node<T> * tmp = this->_first;
     
     /* Recorrer la lista */
     while (tmp != nullptr) {
-        /* Insertar un elemento en la lista nueva */
-        list->insert_back( tmp->getInfo() );
+        /* Enlazar un elemento al final de la lista nueva en O(1) */
+        list->linkAfter(list->_last, Allocator::create(tmp->getInfo()));
         
         /* Desplazarse al siguiente elemento */
         tmp = tmp->getNext();
     }
     
+    /* La copia conserva el orden, así que también conserva el modo */
+    list->_sorted = this->_sorted;
+    
+    /* Y el índice, si esta lista lo tiene */
+    if constexpr (is_hashable<T>::value) {
+        if (this->_index != nullptr) { list->enableIndex(); }
+    }
+    
     return list;
 }
 
-/* Eliminar un rango de elementos */
-template <class T>
-void LinkedList<T>::deleteRange(int from, int to)
+/* Eliminar un rango de elementos
+ * La cadena se desenlaza completa y se libera de una vez con Allocator.
+ * Complejidad: O(to), hay que llegar al final del rango
+ */
+template <class T, class Allocator>
+void LinkedList<T, Allocator>::deleteRange(int from, int to)
 {
-
-   if (from < 0 || to >= _size || from > to) {
+    if (from < 0 || to >= _size || from > to) {
         return; // Índices inválidos
     }
+    
+    Node<T> * last;
+    Node<T> * first = this->detachAfter(this->at(from - 1), to - from + 1, last);
+    
+    Allocator::destroyChain(first);
+}
 
-    Node<T>* current = _first;
-    Node<T>* prev = nullptr;
-    int index = 0;
-
-    // Avanza hasta la posición 'from'
-    while (index < from) {
-        prev = current;
-        current = current->getNext();  // Avanzar
-        index++;
+/* Obtener un subconjunto de elementos de la lista a partir de un rango
+ * Los nodos se mueven a la nueva lista sin copiarse ni reservarse de nuevo.
+ * Complejidad: O(to)
+ */
+template <class T, class Allocator>
+LinkedList<T, Allocator> * LinkedList<T, Allocator>::subList(int from, int to)
+{
+    if (from < 0 || to >= _size || from > to) {
+        return nullptr;  // Índices inválidos
     }
+    
+    LinkedList<T, Allocator> * newList = new LinkedList<T, Allocator>();
+    
+    int count = to - from + 1;
+    Node<T> * last;
+    Node<T> * first = this->detachAfter(this->at(from - 1), count, last);
+    
+    newList->attachAfter(nullptr, first, last, count);
+    
+    // Un rango de una lista ordenada también está ordenado
+    newList->_sorted = _sorted;
+    
+    return newList;
+}
 
-    // Eliminar los nodos entre 'from' y 'to'
-    while (index <= to && current != nullptr) {
-        Node<T>* temp = current;
-        current = current->getNext();  // Avanzar
-        delete temp;  // Eliminar el nodo de la lista
-        _size--;
-        index++;
+/* Mover los elementos [from, to] de other a esta lista
+ * El primero de ellos queda en position (al inicio si position <= 0, al final
+ * si position >= size). other puede ser esta misma lista, siempre que position
+ * no caiga dentro del rango. En modo ordenado se reordena la lista después.
+ * Complejidad: O(to + position) actualizaciones de apuntadores, sin copias
+ */
+template <class T, class Allocator>
+void LinkedList<T, Allocator>::splice(int position, LinkedList<T, Allocator> & other, int from, int to)
+{
+    if (from < 0 || to >= other._size || from > to) { return; }
+    
+    int count = to - from + 1;
+    
+    if (&other == this) {
+        /* Mover un rango dentro de sí mismo no tiene efecto */
+        if (position >= from && position <= to + 1) { return; }
+        
+        /* Las posiciones después del rango se recorren al quitarlo */
+        if (position > to) { position -= count; }
     }
-
-    // Reconectar la lista después de la eliminación
-    if (prev != nullptr) {
-        prev->setNext(current);  // Reconectar desde el nodo anterior
-    } else {
-        _first = current;  // Ajustar el primer nodo si 'from' era el primer nodo
+    
+    Node<T> * last;
+    Node<T> * first = other.detachAfter(other.at(from - 1), count, last);
+    
+    Node<T> * previous;
+    if (position <= 0 || this->empty()) { previous = nullptr; }
+    else if (position >= this->_size) { previous = this->_last; }
+    else { previous = this->at(position - 1); }
+    
+    this->attachAfter(previous, first, last, count);
+    
+    if constexpr (is_less_comparable<T>::value) {
+        if (this->_sorted) { this->sort(); }
     }
 }
-/*Tipo de complejidad deleteRange: O(n). Los valores dentro del rango son eleminados.
-*/
 
-/* Obtener un subconjunto de elementos de la lista a partir de un rango */
-template <class T>
-LinkedList<T> * LinkedList<T>::subList(int from, int to)
+/* Contar las ocurrencias de los valores de una lista
+ * Complejidad: O(n) esperado
+ */
+template <class T, class Allocator>
+ValueCounter<T> countValues(const LinkedList<T, Allocator> & list)
 {
-    if (from < 0 || to >= _size || from > to) {
-        return nullptr;  // Índices inválidos
+    ValueCounter<T> counter(list.size());
+    
+    for (const Node<T> & node : list) {
+        counter.add(node.getInfo());
     }
+    
+    counter.finish();
+    
+    return counter;
+}
 
-    LinkedList<T>* newList = new LinkedList<T>();  // Crear una nueva sublista
-
-    Node<T>* current = _first;
-    Node<T>* previous = nullptr;
-    int index = 0;
-
-    // Avanzar hasta la posición 'from'
-    while (index < from) {
-        previous = current;
-        current = current->getNext();  // Avanzar
-        index++;
+/* Obtener la unión de dos listas
+ * Set: todos los elementos de esta lista y los de listB que no estén en ella,
+ * cada uno una sola vez. Multiset: cada valor aparece max(a, b) veces.
+ * Complejidad: O(n + m) esperado con std::hash; O((n + m) log m) si T solo tiene <
+ */
+template <class T, class Allocator>
+LinkedList<T, Allocator> * LinkedList<T, Allocator>::Union(LinkedList<T, Allocator> * listB, SetSemantics semantics)
+{
+    /* Si ambas están en modo ordenado basta con mezclarlas */
+    if (this->_sorted && listB->_sorted) {
+        return this->mergeUnion(listB, semantics);
     }
-
-    // Mover los elementos seleccionados a la sublista y eliminarlos de la lista principal
-    while (index <= to && current != nullptr) {
-        Node<T>* temp = current;
-
-        // Agregar el elemento actual a la sublista
-        newList->insert_back(current->getInfo());
-
-        // Eliminar el nodo de la lista principal
-        current = current->getNext();
-        if (previous != nullptr) {
-            previous->setNext(current);  // Reconectar la lista si hay un nodo previo
-        } else {
-            _first = current;  // Si 'from' era el primer nodo, ajustar el primer nodo
+    
+    LinkedList<T, Allocator> * newList = this->clone();
+    
+    /* Los elementos de listB se agregan al final, así que la copia deja de
+     * estar en modo ordenado aunque esta lista lo esté */
+    newList->_sorted = false;
+    
+    ValueCounter<T> inB = countValues(*listB);
+    
+    if (semantics == SetSemantics::Multiset) {
+        /* Descontar las ocurrencias que ya aporta esta lista */
+        for (Node<T> * tmp = this->_first; tmp != nullptr; tmp = tmp->getNext()) {
+            inB.take(tmp->getInfo());
         }
-
-        delete temp;  // Liberar el nodo eliminado
-        _size--;  // Reducir el tamaño de la lista principal
-        index++;
+        
+        /* Agregar las ocurrencias sobrantes de listB en su orden */
+        for (Node<T> * tmp = listB->_first; tmp != nullptr; tmp = tmp->getNext()) {
+            if (inB.take(tmp->getInfo())) {
+                newList->linkAfter(newList->_last, Allocator::create(tmp->getInfo()));
+            }
+        }
+        
+        return newList;
     }
-
-    return newList;  // Devolver la sublista con los elementos movidos
+    
+    ValueCounter<T> inA = countValues(*this);
+    
+    for (Node<T> * tmp = listB->_first; tmp != nullptr; tmp = tmp->getNext()) {
+        /* Agregar la primera aparición de cada valor que no esté en esta lista */
+        if (!inA.contains(tmp->getInfo()) && inB.contains(tmp->getInfo())) {
+            newList->linkAfter(newList->_last, Allocator::create(tmp->getInfo()));
+            
+            /* Consumir sus demás ocurrencias para no repetirlo */
+            while (inB.take(tmp->getInfo())) { }
+        }
+    }
+    
+    return newList;
 }
-/*Tipo de complejidad Subnlist: O(n). Ya que se crea una nueva sublista con un cierto rango
-*/
-/* Obtener la unión de dos listas */
-template <class T>
-LinkedList<T> * LinkedList<T>::Union(LinkedList<T> * listB)
-{
-LinkedList<T> * newList = new LinkedList<T>();
-
-    Node<T>* current1 = this->_first;
-    Node<T>* current2 = listB->_first;
 
-    // Añadir todos los elementos de la primera lista usando insert_back
-    while (current1 != nullptr) {
-        newList->insert_back(current1->getInfo()); // Usar insert_back para añadir
-        current1 = current1->getNext();
+/* Obtener la intersección de dos listas
+ * Set: los elementos de esta lista que aparecen en listB.
+ * Multiset: cada valor aparece min(a, b) veces.
+ * Complejidad: O(n + m) esperado con std::hash; O((n + m) log m) si T solo tiene <
+ */
+template <class T, class Allocator>
+LinkedList<T, Allocator> * LinkedList<T, Allocator>::Intersection(LinkedList<T, Allocator> * listB, SetSemantics semantics)
+{
+    if (this->_sorted && listB->_sorted) {
+        return this->mergeFilter(listB, semantics, true);
     }
-
-    // Añadir elementos de la segunda lista, evitando duplicados
-    while (current2 != nullptr) {
-        bool exists = false;
-        Node<T>* NewCurrent = newList->_first;
-        while (NewCurrent != nullptr) {
-            if (NewCurrent->getInfo() == current2->getInfo()) {
-                exists = true;
-                break;
-            }
-            NewCurrent = NewCurrent->getNext();
+    
+    LinkedList<T, Allocator> * intersection = new LinkedList<T, Allocator>();
+    
+    ValueCounter<T> inB = countValues(*listB);
+    
+    for (Node<T> * tmp = this->_first; tmp != nullptr; tmp = tmp->getNext()) {
+        bool common = semantics == SetSemantics::Multiset ? inB.take(tmp->getInfo())
+                                                          : inB.contains(tmp->getInfo());
+        
+        if (common) {
+            intersection->linkAfter(intersection->_last, Allocator::create(tmp->getInfo()));
         }
+    }
+    
+    return intersection;
+}
 
-        if (!exists) {
-            newList->insert_back(current2->getInfo()); // Usar insert_back
+/* Obtener la diferencia de dos listas
+ * Set: los elementos de esta lista que no aparecen en listB.
+ * Multiset: cada ocurrencia en listB cancela una ocurrencia de esta lista.
+ * Complejidad: O(n + m) esperado con std::hash; O((n + m) log m) si T solo tiene <
+ */
+template <class T, class Allocator>
+LinkedList<T, Allocator> * LinkedList<T, Allocator>::Except(LinkedList<T, Allocator> * listB, SetSemantics semantics)
+{
+    if (this->_sorted && listB->_sorted) {
+        return this->mergeFilter(listB, semantics, false);
+    }
+    
+    LinkedList<T, Allocator> * newList = new LinkedList<T, Allocator>();
+    
+    ValueCounter<T> inB = countValues(*listB);
+    
+    for (Node<T> * tmp = this->_first; tmp != nullptr; tmp = tmp->getNext()) {
+        bool removed = semantics == SetSemantics::Multiset ? inB.take(tmp->getInfo())
+                                                           : inB.contains(tmp->getInfo());
+        
+        if (!removed) {
+            newList->linkAfter(newList->_last, Allocator::create(tmp->getInfo()));
         }
-
-        current2 = current2->getNext();
     }
-
+    
     return newList;
 }
-/*Tipo de complejidad Union: O(n + m). Se crea una nueva lista con la unión
-de dos listas*/
-/* Obtener la intersección de dos listas */
-template <class T>
-LinkedList<T> * LinkedList<T>::Intersection(LinkedList<T> * listB)
-{
-  LinkedList<T>* intersection = new LinkedList<T>();
 
-    Node<T>* current1 = this->_first; // Recorrer la lista Union
-
-    // Recorre la lista Union (lista actual)
-    while (current1 != nullptr) {
-        Node<T>* current2 = listB->_first;
-
-        // Comparar el elemento de Union con los elementos de la Sublista
-        while (current2 != nullptr) {
-            if (current1->getInfo() == current2->getInfo()) {
-                // Solo añadir los elementos que están en ambas listas
-                intersection->insert_back(current1->getInfo());
-                break;
-            }
-            current2 = current2->getNext();
+/* Unión por mezcla de dos listas ordenadas
+ * El resultado queda ordenado (y en modo ordenado) en lugar de seguir el
+ * orden "esta lista y luego listB"; los valores son los mismos.
+ * Complejidad: O(n + m)
+ */
+template <class T, class Allocator>
+LinkedList<T, Allocator> * LinkedList<T, Allocator>::mergeUnion(LinkedList<T, Allocator> * listB, SetSemantics semantics)
+{
+    LinkedList<T, Allocator> * newList = new LinkedList<T, Allocator>();
+    
+    Node<T> * a = this->_first;
+    Node<T> * b = listB->_first;
+    
+    auto emit = [newList](Node<T> * node) {
+        newList->linkAfter(newList->_last, Allocator::create(node->getInfo()));
+    };
+    
+    /* Avanzar b después de todas las copias de su valor */
+    auto skip = [](Node<T> * node) {
+        Node<T> * next = node->getNext();
+        while (next != nullptr && !lessThan(node->getInfo(), next->getInfo())) {
+            next = next->getNext();
+        }
+        return next;
+    };
+    
+    while (a != nullptr && b != nullptr) {
+        if (lessThan(a->getInfo(), b->getInfo())) {
+            emit(a);
+            a = a->getNext();
+        }
+        else if (lessThan(b->getInfo(), a->getInfo())) {
+            emit(b);
+            b = semantics == SetSemantics::Multiset ? b->getNext() : skip(b);
+        }
+        else {
+            /* Valor común: la ocurrencia de esta lista cubre la de listB */
+            emit(a);
+            a = a->getNext();
+            b = semantics == SetSemantics::Multiset ? b->getNext() : skip(b);
         }
-
-        current1 = current1->getNext();
     }
-
-    return intersection;  // Devolver la lista Intersection con los elementos comunes
+    
+    for (; a != nullptr; a = a->getNext()) {
+        emit(a);
+    }
+    
+    while (b != nullptr) {
+        emit(b);
+        b = semantics == SetSemantics::Multiset ? b->getNext() : skip(b);
+    }
+    
+    newList->_sorted = true;
+    
+    return newList;
 }
-/*Tipo de complejidad en intersection: O(n x m). Se crea una nueva lista intersection
-para almacera elementos similares entre Union y listB*/
-/* Obtener la diferencia de dos listas */
-template <class T>
-LinkedList<T> * LinkedList<T>::Except(LinkedList<T> * listB)
-{
- LinkedList<T> * newList = new LinkedList<T>();  // Crear una nueva lista para almacenar la diferencia
 
-    Node<T>* current1 = this->_first;  // Recorrer la lista Union (la lista actual)
-
-    // Recorrer la lista Union (lista actual)
-    while (current1 != nullptr) {
-        bool exists = false;
-        Node<T>* current2 = listB->_first;  // Recorrer la sublista B para verificar si el elemento está presente
-
-        // Verificar si el elemento de Union está en la sublista
-        while (current2 != nullptr) {
-            if (current1->getInfo() == current2->getInfo()) {
-                exists = true;  // Marcar que el elemento está presente en ambas listas
-                break;  // Salir del bucle si encontramos el elemento en la sublista
-            }
-            current2 = current2->getNext();  // Avanzar al siguiente nodo en la sublista
+/* Intersección (keep = true) o diferencia (keep = false) por mezcla
+ * Conserva el orden de esta lista, que ya está ordenada.
+ * Complejidad: O(n + m)
+ */
+template <class T, class Allocator>
+LinkedList<T, Allocator> * LinkedList<T, Allocator>::mergeFilter(LinkedList<T, Allocator> * listB, SetSemantics semantics, bool keep)
+{
+    LinkedList<T, Allocator> * newList = new LinkedList<T, Allocator>();
+    
+    Node<T> * b = listB->_first;
+    
+    for (Node<T> * a = this->_first; a != nullptr; a = a->getNext()) {
+        /* Avanzar b hasta el primer valor que no es menor que a */
+        while (b != nullptr && lessThan(b->getInfo(), a->getInfo())) {
+            b = b->getNext();
         }
-
-        // Si el elemento no está en la sublista, lo agregamos a la nueva lista
-        if (!exists) {
-            newList->insert_back(current1->getInfo());
+        
+        bool found = b != nullptr && !lessThan(a->getInfo(), b->getInfo());
+        
+        /* En multiconjunto cada ocurrencia de listB se usa una sola vez */
+        if (found && semantics == SetSemantics::Multiset) {
+            b = b->getNext();
+        }
+        
+        if (found == keep) {
+            newList->linkAfter(newList->_last, Allocator::create(a->getInfo()));
         }
-
-        current1 = current1->getNext();  // Avanzar al siguiente nodo en la lista Union
     }
-
-    return newList;  // Devolver la nueva lista con los elementos que no están en la sublista
+    
+    newList->_sorted = true;
+    
+    return newList;
 }
- /* Tipo de complejidad Except: O(n x m). Ya que recorre cada elemento de la lista Union y por cada elemeneto
- realiza una búsqueda en listB*/   
+
 #endif /* LinkedList_hpp */
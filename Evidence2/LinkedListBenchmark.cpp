@@ -0,0 +1,454 @@
+//
+//  LinkedListBenchmark.cpp
+//  LinkedList
+//
+//  Created by Developer on 18/10/26.
+//
+//  Mide las operaciones públicas de LinkedList contra std::list,
+//  std::forward_list y std::vector, y verifica que el crecimiento medido
+//  coincida con la complejidad documentada en LinkedList.hpp.
+//
+//  Compilar: g++ -std=c++17 -O2 LinkedListBenchmark.cpp -o LinkedListBenchmark
+//  Uso: LinkedListBenchmark [exponente máximo = 5] [exponente mínimo = 2]
+//  Los tamaños van de 10^mínimo a 10^máximo (hasta 10^7).
+//  Regresa 1 si alguna operación crece más rápido que lo documentado.
+//
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <list>
+#include <forward_list>
+#include <algorithm>
+#include <iterator>
+#include <functional>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include "LinkedList.hpp"
+
+/* Conteo de reservas de memoria
+ * Cada bloque lleva un encabezado con su tamaño para saber cuánta memoria
+ * sigue viva y registrar el máximo. El benchmark corre en un solo hilo.
+ */
+namespace {
+    const std::size_t Header = alignof(std::max_align_t);
+
+    std::size_t allocations = 0;
+    std::size_t liveBytes = 0;
+    std::size_t peakBytes = 0;
+
+    void * allocate(std::size_t size)
+    {
+        void * block = std::malloc(size + Header);
+        if (block == nullptr) { throw std::bad_alloc(); }
+
+        *static_cast<std::size_t *>(block) = size;
+
+        ++allocations;
+        liveBytes += size;
+        if (liveBytes > peakBytes) { peakBytes = liveBytes; }
+
+        return static_cast<char *>(block) + Header;
+    }
+
+    void release(void * pointer)
+    {
+        if (pointer == nullptr) { return; }
+
+        void * block = static_cast<char *>(pointer) - Header;
+        liveBytes -= *static_cast<std::size_t *>(block);
+        std::free(block);
+    }
+}
+
+void * operator new(std::size_t size) { return allocate(size); }
+void * operator new[](std::size_t size) { return allocate(size); }
+void * operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    try { return allocate(size); } catch (...) { return nullptr; }
+}
+void * operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+    try { return allocate(size); } catch (...) { return nullptr; }
+}
+void operator delete(void * pointer) noexcept { release(pointer); }
+void operator delete[](void * pointer) noexcept { release(pointer); }
+void operator delete(void * pointer, std::size_t) noexcept { release(pointer); }
+void operator delete[](void * pointer, std::size_t) noexcept { release(pointer); }
+void operator delete(void * pointer, const std::nothrow_t &) noexcept { release(pointer); }
+void operator delete[](void * pointer, const std::nothrow_t &) noexcept { release(pointer); }
+
+/* Registro de 64 bytes */
+struct Record {
+    long id = 0;
+    char payload[56] = {};
+
+    Record() {}
+    Record(long _id) : id(_id) { std::memset(payload, (int) (_id & 0x7f), sizeof(payload)); }
+
+    bool operator ==(const Record & other) const { return id == other.id; }
+    bool operator !=(const Record & other) const { return id != other.id; }
+    bool operator <(const Record & other) const { return id < other.id; }
+};
+
+std::ostream & operator <<(std::ostream & os, const Record & record) { return os << record.id; }
+
+namespace std {
+    template <>
+    struct hash<Record> {
+        size_t operator ()(const Record & record) const { return hash<long>()(record.id); }
+    };
+}
+
+/* Valores de prueba; las cadenas no caben en el búfer corto de std::string */
+template <class T> T makeValue(long i);
+template <> int makeValue<int>(long i) { return (int) i; }
+template <> std::string makeValue<std::string>(long i) { return "benchmark-key-" + std::to_string(i); }
+template <> Record makeValue<Record>(long i) { return Record(i); }
+
+template <class T> const char * typeName();
+template <> const char * typeName<int>() { return "int"; }
+template <> const char * typeName<std::string>() { return "string"; }
+template <> const char * typeName<Record>() { return "record64"; }
+
+/* Resultado de una medición */
+struct Sample {
+    double nanosPerOp = 0;
+    double allocsPerOp = 0;
+    std::size_t peakBytes = 0;
+};
+
+/* Trabajo aproximado (en elementos recorridos) que se busca por medición */
+const long Work = 1000000;
+
+/* Medir run, que hace ops operaciones, repitiéndolo reps veces
+ * prepare se llama antes de cada repetición y no se mide.
+ */
+Sample measure(long ops, long reps, const std::function<void()> & prepare, const std::function<void()> & run)
+{
+    Sample sample;
+    double nanos = 0;
+    std::size_t allocs = 0;
+
+    for (long r = 0; r < reps; ++r) {
+        prepare();
+
+        std::size_t baseBytes = liveBytes;
+        std::size_t baseAllocs = allocations;
+        peakBytes = liveBytes;
+
+        auto start = std::chrono::steady_clock::now();
+        run();
+        auto stop = std::chrono::steady_clock::now();
+
+        nanos += std::chrono::duration<double, std::nano>(stop - start).count();
+        allocs += allocations - baseAllocs;
+        sample.peakBytes = std::max(sample.peakBytes, peakBytes - baseBytes);
+    }
+
+    sample.nanosPerOp = nanos / (double) (ops * reps);
+    sample.allocsPerOp = (double) allocs / (double) (ops * reps);
+
+    return sample;
+}
+
+/* Una fila de la tabla y los datos para ajustar la curva */
+struct Series {
+    std::string operation;
+    std::string type;
+    std::string container;
+    int exponent;                      /* complejidad documentada: 0 = O(1), 1 = O(n) */
+    std::vector<double> sizes;
+    std::vector<double> nanos;
+};
+
+std::vector<Series> results;
+
+void report(const std::string & operation, const char * type, const std::string & container,
+            int exponent, long n, const Sample & sample)
+{
+    std::cout << std::left << std::setw(14) << operation
+              << std::setw(10) << type
+              << std::setw(14) << container
+              << std::right << std::setw(10) << n
+              << std::setw(14) << std::fixed << std::setprecision(1) << sample.nanosPerOp
+              << std::setw(14) << std::setprecision(0) << 1e9 / sample.nanosPerOp
+              << std::setw(10) << std::setprecision(2) << sample.allocsPerOp
+              << std::setw(12) << sample.peakBytes / 1024
+              << std::endl;
+
+    for (auto & series : results) {
+        if (series.operation == operation && series.type == type && series.container == container) {
+            series.sizes.push_back((double) n);
+            series.nanos.push_back(sample.nanosPerOp);
+            return;
+        }
+    }
+
+    results.push_back({ operation, type, container, exponent, { (double) n }, { sample.nanosPerOp } });
+}
+
+/* Repeticiones para que una operación O(n) haga alrededor de Work pasos */
+long linearReps(long n) { return std::max(1L, std::min(1000L, Work / std::max(1L, n))); }
+
+/* Construir una LinkedList con los valores dados */
+template <class T>
+void fill(LinkedList<T> & list, const std::vector<T> & values)
+{
+    list.clear();
+    list.append(values.begin(), values.end());
+}
+
+/* Medir todas las operaciones para un tipo y un tamaño */
+template <class T>
+void benchmark(long n)
+{
+    const char * type = typeName<T>();
+
+    std::vector<T> values;
+    values.reserve(n);
+    for (long i = 0; i < n; ++i) { values.push_back(makeValue<T>(i)); }
+
+    /* Un valor que no está en la lista obliga a recorrerla completa */
+    T missing = makeValue<T>(-1);
+
+    /* La segunda lista de las operaciones de conjuntos comparte la mitad */
+    std::vector<T> others;
+    others.reserve(n);
+    for (long i = 0; i < n; ++i) { others.push_back(makeValue<T>(i + n / 2)); }
+
+    long buildReps = std::max(1L, 100000L / n);
+    long linear = linearReps(n);
+    long middleOps = std::min(n, 50L);
+    long middleReps = std::max(1L, std::min(100L, Work / (n * middleOps)));
+
+    LinkedList<T> list;
+    LinkedList<T> listB;
+    std::list<T> stdList;
+    std::forward_list<T> forwardList;
+    std::vector<T> vector;
+
+    auto nothing = [] {};
+
+    /* Insertar al inicio, O(1) */
+    report("insert_front", type, "LinkedList", 0, n,
+           measure(n, buildReps, [&] { list.clear(); }, [&] { for (const T & v : values) { list.insert_front(v); } }));
+    report("insert_front", type, "std::list", 0, n,
+           measure(n, buildReps, [&] { stdList.clear(); }, [&] { for (const T & v : values) { stdList.push_front(v); } }));
+    report("insert_front", type, "forward_list", 0, n,
+           measure(n, buildReps, [&] { forwardList.clear(); }, [&] { for (const T & v : values) { forwardList.push_front(v); } }));
+    if (n <= 10000) {
+        report("insert_front", type, "std::vector", 1, n,
+               measure(n, 1, [&] { vector.clear(); }, [&] { for (const T & v : values) { vector.insert(vector.begin(), v); } }));
+    }
+
+    /* Insertar al final, O(1) */
+    report("insert_back", type, "LinkedList", 0, n,
+           measure(n, buildReps, [&] { list.clear(); }, [&] { for (const T & v : values) { list.insert_back(v); } }));
+    report("insert_back", type, "std::list", 0, n,
+           measure(n, buildReps, [&] { stdList.clear(); }, [&] { for (const T & v : values) { stdList.push_back(v); } }));
+    report("insert_back", type, "std::vector", 0, n,
+           measure(n, buildReps, [&] { vector.clear(); vector.shrink_to_fit(); }, [&] { for (const T & v : values) { vector.push_back(v); } }));
+
+    /* Dejar cargados todos los contenedores */
+    fill(list, values);
+    fill(listB, others);
+    stdList.assign(values.begin(), values.end());
+    forwardList.assign(values.begin(), values.end());
+    vector.assign(values.begin(), values.end());
+
+    /* Insertar en medio, O(n) */
+    report("insert_mid", type, "LinkedList", 1, n,
+           measure(middleOps, middleReps, [&] { fill(list, values); },
+                   [&] { for (long i = 0; i < middleOps; ++i) { list.insert(values[i], (int) (n / 2)); } }));
+    report("insert_mid", type, "std::list", 1, n,
+           measure(middleOps, middleReps, [&] { stdList.assign(values.begin(), values.end()); },
+                   [&] { for (long i = 0; i < middleOps; ++i) { stdList.insert(std::next(stdList.begin(), n / 2), values[i]); } }));
+    report("insert_mid", type, "std::vector", 1, n,
+           measure(middleOps, middleReps, [&] { vector.assign(values.begin(), values.end()); },
+                   [&] { for (long i = 0; i < middleOps; ++i) { vector.insert(vector.begin() + n / 2, values[i]); } }));
+
+    fill(list, values);
+    stdList.assign(values.begin(), values.end());
+    vector.assign(values.begin(), values.end());
+
+    /* Acceso por posición, O(n) */
+    volatile long sink = 0;
+    report("at", type, "LinkedList", 1, n,
+           measure(1, linear, nothing, [&] { sink = sink + (list.at((int) (n - 1)) != nullptr); }));
+    report("at", type, "std::list", 1, n,
+           measure(1, linear, nothing, [&] { sink = sink + (std::next(stdList.begin(), n - 1) != stdList.end()); }));
+    report("at", type, "std::vector", 0, n,
+           measure(1, linear, nothing, [&] { sink = sink + (&vector[n - 1] != nullptr); }));
+
+    /* Buscar un valor que no está, O(n) */
+    report("index", type, "LinkedList", 1, n,
+           measure(1, linear, nothing, [&] { sink = sink + list.index(missing); }));
+    report("index", type, "std::list", 1, n,
+           measure(1, linear, nothing, [&] { sink = sink + (std::find(stdList.begin(), stdList.end(), missing) != stdList.end()); }));
+    report("index", type, "std::vector", 1, n,
+           measure(1, linear, nothing, [&] { sink = sink + (std::find(vector.begin(), vector.end(), missing) != vector.end()); }));
+
+    /* Contar ocurrencias, O(n) */
+    report("count", type, "LinkedList", 1, n,
+           measure(1, linear, nothing, [&] { sink = sink + list.count(values[0]); }));
+    report("count", type, "std::list", 1, n,
+           measure(1, linear, nothing, [&] { sink = sink + std::count(stdList.begin(), stdList.end(), values[0]); }));
+    report("count", type, "std::vector", 1, n,
+           measure(1, linear, nothing, [&] { sink = sink + std::count(vector.begin(), vector.end(), values[0]); }));
+
+    /* Invertir, O(n) */
+    report("reverse", type, "LinkedList", 1, n,
+           measure(1, linear, nothing, [&] { list.reverse(); }));
+    report("reverse", type, "std::list", 1, n,
+           measure(1, linear, nothing, [&] { stdList.reverse(); }));
+    report("reverse", type, "forward_list", 1, n,
+           measure(1, linear, nothing, [&] { forwardList.reverse(); }));
+    report("reverse", type, "std::vector", 1, n,
+           measure(1, linear, nothing, [&] { std::reverse(vector.begin(), vector.end()); }));
+
+    /* Clonar, O(n) */
+    report("clone", type, "LinkedList", 1, n,
+           measure(1, linear, nothing, [&] { delete list.clone(); }));
+    report("clone", type, "std::list", 1, n,
+           measure(1, linear, nothing, [&] { std::list<T> copy(stdList); sink = sink + (long) copy.size(); }));
+    report("clone", type, "std::vector", 1, n,
+           measure(1, linear, nothing, [&] { std::vector<T> copy(vector); sink = sink + (long) copy.size(); }));
+
+    /* Sublista y borrado de rango: la mitad central, O(to) */
+    long from = n / 4;
+    long to = from + n / 2;
+
+    report("subList", type, "LinkedList", 1, n,
+           measure(1, linear, [&] { fill(list, values); }, [&] { delete list.subList((int) from, (int) to); }));
+    report("subList", type, "std::list", 1, n,
+           measure(1, linear, [&] { stdList.assign(values.begin(), values.end()); }, [&] {
+               std::list<T> part;
+               part.splice(part.begin(), stdList, std::next(stdList.begin(), from), std::next(stdList.begin(), to + 1));
+           }));
+    report("subList", type, "std::vector", 1, n,
+           measure(1, linear, [&] { vector.assign(values.begin(), values.end()); }, [&] {
+               std::vector<T> part(std::make_move_iterator(vector.begin() + from), std::make_move_iterator(vector.begin() + to + 1));
+               vector.erase(vector.begin() + from, vector.begin() + to + 1);
+           }));
+
+    report("deleteRange", type, "LinkedList", 1, n,
+           measure(1, linear, [&] { fill(list, values); }, [&] { list.deleteRange((int) from, (int) to); }));
+    report("deleteRange", type, "std::list", 1, n,
+           measure(1, linear, [&] { stdList.assign(values.begin(), values.end()); }, [&] {
+               stdList.erase(std::next(stdList.begin(), from), std::next(stdList.begin(), to + 1));
+           }));
+    report("deleteRange", type, "std::vector", 1, n,
+           measure(1, linear, [&] { vector.assign(values.begin(), values.end()); }, [&] {
+               vector.erase(vector.begin() + from, vector.begin() + to + 1);
+           }));
+
+    /* Operaciones de conjuntos, O(n + m) esperado
+     * La referencia es ordenar dos vectores y usar std::set_*
+     */
+    fill(list, values);
+
+    std::vector<T> sortedA(values);
+    std::vector<T> sortedB(others);
+    auto setReference = [&](int which) {
+        std::vector<T> a(sortedA);
+        std::vector<T> b(sortedB);
+        std::sort(a.begin(), a.end());
+        std::sort(b.begin(), b.end());
+        std::vector<T> out;
+        if (which == 0) { std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(out)); }
+        if (which == 1) { std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(out)); }
+        if (which == 2) { std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(out)); }
+        sink = sink + (long) out.size();
+    };
+
+    report("Union", type, "LinkedList", 1, n,
+           measure(1, linear, nothing, [&] { delete list.Union(&listB); }));
+    report("Union", type, "sort+set_*", 1, n,
+           measure(1, linear, nothing, [&] { setReference(0); }));
+    report("Intersection", type, "LinkedList", 1, n,
+           measure(1, linear, nothing, [&] { delete list.Intersection(&listB); }));
+    report("Intersection", type, "sort+set_*", 1, n,
+           measure(1, linear, nothing, [&] { setReference(1); }));
+    report("Except", type, "LinkedList", 1, n,
+           measure(1, linear, nothing, [&] { delete list.Except(&listB); }));
+    report("Except", type, "sort+set_*", 1, n,
+           measure(1, linear, nothing, [&] { setReference(2); }));
+}
+
+/* Pendiente de la recta por mínimos cuadrados sobre log(n) y log(tiempo) */
+double fitSlope(const std::vector<double> & sizes, const std::vector<double> & nanos)
+{
+    /* Los tamaños más pequeños están dominados por el costo fijo */
+    std::size_t skip = sizes.size() > 3 ? 1 : 0;
+    double n = 0, sx = 0, sy = 0, sxx = 0, sxy = 0;
+
+    for (std::size_t i = skip; i < sizes.size(); ++i) {
+        double x = std::log(sizes[i]);
+        double y = std::log(nanos[i]);
+        n += 1; sx += x; sy += y; sxx += x * x; sxy += x * y;
+    }
+
+    double denominator = n * sxx - sx * sx;
+
+    return denominator == 0 ? 0 : (n * sxy - sx * sy) / denominator;
+}
+
+int main(int argc, const char * argv[])
+{
+    int maxExponent = argc > 1 ? std::atoi(argv[1]) : 5;
+    int minExponent = argc > 2 ? std::atoi(argv[2]) : 2;
+
+    maxExponent = std::max(2, std::min(7, maxExponent));
+    minExponent = std::max(2, std::min(maxExponent, minExponent));
+
+    std::cout << std::left << std::setw(14) << "operation"
+              << std::setw(10) << "type"
+              << std::setw(14) << "container"
+              << std::right << std::setw(10) << "n"
+              << std::setw(14) << "ns/op"
+              << std::setw(14) << "ops/s"
+              << std::setw(10) << "allocs/op"
+              << std::setw(12) << "peak KB"
+              << std::endl;
+
+    long n = 1;
+    for (int e = 0; e < minExponent; ++e) { n *= 10; }
+
+    for (int e = minExponent; e <= maxExponent; ++e, n *= 10) {
+        benchmark<int>(n);
+        benchmark<std::string>(n);
+        benchmark<Record>(n);
+    }
+
+    /* Comparar la pendiente medida con la complejidad documentada
+     * Una pendiente de 0 es O(1) y de 1 es O(n); se tolera medio orden por
+     * ruido y efectos de caché.
+     */
+    const double tolerance = 0.5;
+    int failures = 0;
+
+    std::cout << std::endl << "Complexity check (LinkedList)" << std::endl;
+
+    for (const Series & series : results) {
+        if (series.container != "LinkedList" || series.sizes.size() < 2) { continue; }
+
+        double slope = fitSlope(series.sizes, series.nanos);
+        bool ok = slope <= series.exponent + tolerance;
+
+        std::cout << std::left << std::setw(14) << series.operation
+                  << std::setw(10) << series.type
+                  << "documented O(" << (series.exponent == 0 ? "1" : "n") << ")"
+                  << "  fitted n^" << std::fixed << std::setprecision(2) << slope
+                  << (ok ? "" : "  FAIL") << std::endl;
+
+        if (!ok) { ++failures; }
+    }
+
+    return failures == 0 ? 0 : 1;
+}
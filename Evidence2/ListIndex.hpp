@@ -0,0 +1,126 @@
+//
+//  ListIndex.hpp
+//  LinkedList
+//
+//  Created by Developer on 18/10/26.
+//
+
+#ifndef ListIndex_hpp
+#define ListIndex_hpp
+
+#include <vector>
+#include <unordered_map>
+#include "Node.hpp"
+
+/* Índice auxiliar de una LinkedList
+ * La lista avisa cada vez que enlaza o desenlaza un nodo y el índice mantiene
+ * dos tablas: valor -> nodos con ese valor, y nodo -> su anterior. Con ellas
+ * count() es O(1), index() descarta en O(1) los valores ausentes y
+ * remove(Node *) no necesita buscar el anterior.
+ * La clase base no depende de std::hash, así que LinkedList<T> compila para
+ * cualquier T aunque solo los tipos con hash puedan activar el índice.
+ */
+template <class T>
+class ListIndex {
+public:
+    virtual ~ListIndex() {}
+
+    /* Se enlazó node después de previous (nullptr si quedó al inicio) */
+    virtual void linked(Node<T> * previous, Node<T> * node) = 0;
+
+    /* Se desenlazó node, que estaba después de previous */
+    virtual void unlinked(Node<T> * previous, Node<T> * node, Node<T> * next) = 0;
+
+    /* Volver a construir el índice a partir del primer nodo */
+    virtual void rebuild(Node<T> * first) = 0;
+
+    /* Determinar si node está en la lista y obtener su anterior */
+    virtual bool find(const Node<T> * node, Node<T> * & previous) const = 0;
+
+    /* Obtener cuántos nodos tienen value */
+    virtual int count(const T & value) const = 0;
+};
+
+/* Índice con tablas hash
+ * Complejidad: O(1) esperado por aviso y por consulta
+ * Nota: si se modifica el valor de un nodo con getInfo() o setInfo() hay que
+ * llamar a LinkedList::rebuildIndex()
+ */
+template <class T>
+class HashListIndex : public ListIndex<T> {
+    struct Entry {
+        Node<T> * previous;
+        int slot;                          /* posición en su vector de byValue */
+    };
+
+    std::unordered_map< T, std::vector< Node<T> * > > byValue;
+    std::unordered_map< const Node<T> *, Entry > byNode;
+
+    void add(Node<T> * previous, Node<T> * node)
+    {
+        std::vector< Node<T> * > & nodes = byValue[node->getInfo()];
+        byNode[node] = { previous, (int) nodes.size() };
+        nodes.push_back(node);
+    }
+
+public:
+    void linked(Node<T> * previous, Node<T> * node) override
+    {
+        this->add(previous, node);
+
+        if (node->getNext() != nullptr) {
+            byNode[node->getNext()].previous = node;
+        }
+    }
+
+    void unlinked(Node<T> * previous, Node<T> * node, Node<T> * next) override
+    {
+        auto entry = byNode.find(node);
+        if (entry == byNode.end()) { return; }
+
+        /* Quitarlo de su vector cambiándolo por el último */
+        auto values = byValue.find(node->getInfo());
+        std::vector< Node<T> * > & nodes = values->second;
+        Node<T> * moved = nodes.back();
+
+        nodes[entry->second.slot] = moved;
+        byNode[moved].slot = entry->second.slot;
+        nodes.pop_back();
+
+        if (nodes.empty()) { byValue.erase(values); }
+        byNode.erase(node);
+
+        if (next != nullptr) {
+            byNode[next].previous = previous;
+        }
+    }
+
+    void rebuild(Node<T> * first) override
+    {
+        byValue.clear();
+        byNode.clear();
+
+        Node<T> * previous = nullptr;
+        for (Node<T> * node = first; node != nullptr; node = node->getNext()) {
+            this->add(previous, node);
+            previous = node;
+        }
+    }
+
+    bool find(const Node<T> * node, Node<T> * & previous) const override
+    {
+        auto entry = byNode.find(node);
+        if (entry == byNode.end()) { return false; }
+
+        previous = entry->second.previous;
+        return true;
+    }
+
+    int count(const T & value) const override
+    {
+        auto values = byValue.find(value);
+        return values == byValue.end() ? 0 : (int) values->second.size();
+    }
+};
+
+#endif /* ListIndex_hpp */
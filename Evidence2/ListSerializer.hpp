@@ -0,0 +1,310 @@
+//
+//  ListSerializer.hpp
+//  LinkedList
+//
+//  Created by Developer on 18/10/26.
+//
+
+#ifndef ListSerializer_hpp
+#define ListSerializer_hpp
+
+#include <iostream>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+#include "LinkedList.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define LINKEDLIST_HAS_MMAP 1
+#endif
+
+/* Formato binario de una LinkedList
+ *
+ *     "LLB1"  uint32 0x01020304  uint32 elementSize  uint32 0  uint64 count
+ *     count elementos
+ *
+ * Los enteros van en el orden de bytes de la máquina; el marcador 0x01020304
+ * hace que un archivo de otra arquitectura se rechace en vez de leerse mal.
+ * Un T trivialmente copiable se guarda tal cual (elementSize = sizeof(T)) y
+ * un std::string como uint32 longitud + bytes (elementSize = 0).
+ */
+namespace listformat {
+    const char magic[4] = { 'L', 'L', 'B', '1' };
+    const std::uint32_t byteOrder = 0x01020304;
+    const std::size_t headerSize = 24;
+}
+
+/* Cómo se codifica cada valor; solo existen las especializaciones de abajo */
+template <class T, class = void>
+struct BinaryCodec {
+    static constexpr bool supported = false;
+};
+
+/* Búfer de escritura: junta los bytes y los escribe en bloques grandes */
+class BinaryWriter {
+    std::ostream & _os;
+    std::vector<char> _buffer;
+    std::size_t _used = 0;
+
+public:
+    explicit BinaryWriter(std::ostream & os, std::size_t capacity = 1 << 16) : _os(os), _buffer(capacity) {}
+
+    ~BinaryWriter() { this->flush(); }
+
+    void put(const void * data, std::size_t count)
+    {
+        if (_used + count > _buffer.size()) {
+            this->flush();
+
+            /* Lo que no cabe en el búfer se escribe directo */
+            if (count >= _buffer.size()) {
+                _os.write(static_cast<const char *>(data), count);
+                return;
+            }
+        }
+
+        std::memcpy(_buffer.data() + _used, data, count);
+        _used += count;
+    }
+
+    void flush()
+    {
+        if (_used > 0) {
+            _os.write(_buffer.data(), _used);
+            _used = 0;
+        }
+    }
+};
+
+/* Tipos trivialmente copiables: sizeof(T) bytes por valor
+ * Se lee con memcpy porque un archivo mapeado no garantiza la alineación.
+ */
+template <class T>
+struct BinaryCodec<T, typename std::enable_if<std::is_trivially_copyable<T>::value>::type> {
+    static constexpr bool supported = true;
+    static constexpr std::uint32_t elementSize = sizeof(T);
+
+    static void encode(BinaryWriter & out, const T & value) { out.put(&value, sizeof(T)); }
+
+    /* Comprobar que count valores caben en [at, end) */
+    static bool validate(const char * at, const char * end, std::uint64_t count)
+    {
+        return (std::uint64_t) (end - at) / sizeof(T) >= count;
+    }
+
+    static T decode(const char * & at)
+    {
+        T value;
+        std::memcpy(&value, at, sizeof(T));
+        at += sizeof(T);
+        return value;
+    }
+
+    static void skip(const char * & at) { at += sizeof(T); }
+};
+
+/* std::string: uint32 longitud + bytes */
+template <>
+struct BinaryCodec<std::string> {
+    static constexpr bool supported = true;
+    static constexpr std::uint32_t elementSize = 0;
+
+    static void encode(BinaryWriter & out, const std::string & value)
+    {
+        std::uint32_t length = (std::uint32_t) value.size();
+        out.put(&length, sizeof(length));
+        out.put(value.data(), value.size());
+    }
+
+    static bool validate(const char * at, const char * end, std::uint64_t count)
+    {
+        for (std::uint64_t i = 0; i < count; ++i) {
+            std::uint32_t length;
+            if ((std::size_t) (end - at) < sizeof(length)) { return false; }
+
+            std::memcpy(&length, at, sizeof(length));
+            at += sizeof(length);
+
+            if ((std::size_t) (end - at) < length) { return false; }
+            at += length;
+        }
+
+        return true;
+    }
+
+    static std::string decode(const char * & at)
+    {
+        std::uint32_t length;
+        std::memcpy(&length, at, sizeof(length));
+        at += sizeof(length);
+
+        std::string value(at, length);
+        at += length;
+        return value;
+    }
+
+    static void skip(const char * & at)
+    {
+        std::uint32_t length;
+        std::memcpy(&length, at, sizeof(length));
+        at += sizeof(length) + length;
+    }
+};
+
+/* Iterador de entrada que decodifica los valores de un bloque de memoria
+ * Permite construir la lista con LinkedList::append en una sola pasada.
+ */
+template <class T>
+class BinaryCursor {
+    const char * _at = nullptr;
+    std::uint64_t _left = 0;
+
+public:
+    typedef std::input_iterator_tag iterator_category;
+    typedef T value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const T * pointer;
+    typedef T reference;
+
+    BinaryCursor() {}
+    BinaryCursor(const char * _aat, std::uint64_t _aleft) : _at(_aat), _left(_aleft) {}
+
+    /* Cada valor se lee una sola vez, como en cualquier iterador de entrada */
+    T operator *() const { const char * at = _at; return BinaryCodec<T>::decode(at); }
+
+    BinaryCursor & operator ++()
+    {
+        BinaryCodec<T>::skip(_at);
+        --_left;
+        return *this;
+    }
+
+    bool operator == (const BinaryCursor & it) const { return _left == it._left; }
+    bool operator != (const BinaryCursor & it) const { return _left != it._left; }
+};
+
+/* Escribir una lista en formato binario
+ * Complejidad: O(n), en bloques de 64 KiB
+ */
+template <class T, class Allocator>
+bool writeBinary(std::ostream & os, const LinkedList<T, Allocator> & list)
+{
+    static_assert(BinaryCodec<T>::supported, "writeBinary requires a trivially copyable T or std::string");
+
+    std::uint32_t header[3] = { listformat::byteOrder, BinaryCodec<T>::elementSize, 0 };
+    std::uint64_t count = (std::uint64_t) list.size();
+
+    {
+        BinaryWriter out(os);
+
+        out.put(listformat::magic, sizeof(listformat::magic));
+        out.put(header, sizeof(header));
+        out.put(&count, sizeof(count));
+
+        for (const Node<T> & node : list) {
+            BinaryCodec<T>::encode(out, node.getInfo());
+        }
+    }
+
+    return (bool) os;
+}
+
+/* Guardar una lista en un archivo */
+template <class T, class Allocator>
+bool saveBinary(const std::string & path, const LinkedList<T, Allocator> & list)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+    return file && writeBinary(file, list) && file.flush();
+}
+
+/* Agregar al final de list los valores de un bloque en formato binario
+ * Primero se valida el bloque completo, así que un archivo truncado o de otro
+ * tipo regresa false sin modificar la lista.
+ * Complejidad: O(n); la validación es O(1) para tipos de tamaño fijo
+ */
+template <class T, class Allocator>
+bool readBinary(const char * data, std::size_t size, LinkedList<T, Allocator> & list)
+{
+    static_assert(BinaryCodec<T>::supported, "readBinary requires a trivially copyable T or std::string");
+
+    if (size < listformat::headerSize || std::memcmp(data, listformat::magic, sizeof(listformat::magic)) != 0) {
+        return false;
+    }
+
+    std::uint32_t header[3];
+    std::uint64_t count;
+    std::memcpy(header, data + 4, sizeof(header));
+    std::memcpy(&count, data + 16, sizeof(count));
+
+    if (header[0] != listformat::byteOrder || header[1] != BinaryCodec<T>::elementSize) {
+        return false;
+    }
+
+    const char * body = data + listformat::headerSize;
+
+    if (!BinaryCodec<T>::validate(body, data + size, count)) { return false; }
+
+    list.append(BinaryCursor<T>(body, count), BinaryCursor<T>(nullptr, 0));
+
+    return true;
+}
+
+/* Leer una lista de un flujo; lee todo el flujo a memoria */
+template <class T, class Allocator>
+bool readBinary(std::istream & is, LinkedList<T, Allocator> & list)
+{
+    std::vector<char> data((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+
+    return readBinary(data.data(), data.size(), list);
+}
+
+/* Cargar una lista de un archivo
+ * Con mmap el archivo se decodifica directamente desde el caché de páginas, sin
+ * copiarlo antes a un búfer. Para cargar sin un new por nodo se usa una lista
+ * con PoolNodeAllocator.
+ * Complejidad: O(n)
+ */
+template <class T, class Allocator>
+bool loadBinary(const std::string & path, LinkedList<T, Allocator> & list)
+{
+#ifdef LINKEDLIST_HAS_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) { return false; }
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || (std::size_t) info.st_size < listformat::headerSize) {
+        ::close(fd);
+        return false;
+    }
+
+    std::size_t size = (std::size_t) info.st_size;
+    void * data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+
+    if (data == MAP_FAILED) { return false; }
+
+    ::madvise(data, size, MADV_SEQUENTIAL);
+
+    bool loaded = readBinary(static_cast<const char *>(data), size, list);
+
+    ::munmap(data, size);
+
+    return loaded;
+#else
+    std::ifstream file(path, std::ios::binary);
+
+    return file && readBinary(file, list);
+#endif
+}
+
+#endif /* ListSerializer_hpp */
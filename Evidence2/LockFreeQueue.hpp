@@ -0,0 +1,253 @@
+//
+//  LockFreeQueue.hpp
+//  LinkedList
+//
+//  Created by Developer on 18/10/26.
+//
+
+#ifndef LockFreeQueue_hpp
+#define LockFreeQueue_hpp
+
+#include <atomic>
+#include <utility>
+#include "Node.hpp"
+#include "NodePool.hpp"
+#include "HazardPointers.hpp"
+
+/* Celda interna de las estructuras sin candados
+ * Node<T> tiene un next normal, así que la celda agrega el enlace atómico y
+ * lleva al nodo como carga: un nodo pasa de una LinkedList a la cola (y de
+ * regreso) sin copiar su valor. Cada celda vive en un Node<ConcurrentCell>
+ * reservado con la misma política que los nodos (Allocator::rebind). Con
+ * PoolNodeAllocator los nodos y celdas que libera el consumidor regresan al
+ * pool del productor, así que encolar deja de llamar a malloc en cuanto el
+ * productor tiene los bloques para los elementos en tránsito.
+ */
+template <class T>
+struct ConcurrentCell {
+    std::atomic<Node<ConcurrentCell> *> next { nullptr };
+    Node<T> * node = nullptr;
+
+    ConcurrentCell(Node<T> * _node = nullptr) : node(_node) {}
+};
+
+/* Cola FIFO sin candados para varios productores y consumidores (Michael–Scott)
+ * La cola siempre tiene una celda ficticia al frente; encolar enlaza al final
+ * y avanza tail, desencolar avanza head. Un hilo que encuentra tail atrasado
+ * lo ayuda a avanzar, así que ninguna operación espera a otra.
+ * Las celdas retiradas se liberan con HazardPointers.
+ * Los nodos encolados pertenecen a la cola hasta que se desencolan; los que
+ * queden al destruirla se liberan con Allocator.
+ */
+template <class T, class Allocator = NodeAllocator<T>>
+class LockFreeQueue {
+    typedef Node<ConcurrentCell<T>> Cell;
+    typedef typename Allocator::template rebind<ConcurrentCell<T>> CellAllocator;
+
+    std::atomic<Cell *> _head;
+    std::atomic<Cell *> _tail;
+
+public:
+    LockFreeQueue()
+    {
+        Cell * dummy = CellAllocator::create();
+        _head.store(dummy);
+        _tail.store(dummy);
+    }
+
+    LockFreeQueue(const LockFreeQueue &) = delete;
+    LockFreeQueue & operator =(const LockFreeQueue &) = delete;
+
+    /* Destructor: no debe haber otros hilos usando la cola */
+    ~LockFreeQueue()
+    {
+        while (Node<T> * node = this->dequeue()) {
+            Allocator::destroy(node);
+        }
+        CellAllocator::destroy(_head.load());
+    }
+
+    /* Encolar un valor */
+    void enqueue(const T & value) { this->enqueue(Allocator::create(value)); }
+    void enqueue(T && value) { this->enqueue(Allocator::create(std::move(value))); }
+
+    /* Encolar un nodo existente (por ejemplo, uno que se eliminó de una lista)
+     * Complejidad: O(1) amortizado
+     */
+    void enqueue(Node<T> * node)
+    {
+        Cell * cell = CellAllocator::create(std::in_place, node);
+
+        while (true) {
+            Cell * tail = HazardPointers::protect(0, _tail);
+            Cell * next = tail->getInfo().next.load();
+
+            if (tail != _tail.load()) { continue; }
+
+            if (next != nullptr) {
+                /* tail está atrasado: ayudar a avanzarlo */
+                _tail.compare_exchange_weak(tail, next);
+                continue;
+            }
+
+            if (tail->getInfo().next.compare_exchange_weak(next, cell)) {
+                _tail.compare_exchange_strong(tail, cell);
+                break;
+            }
+        }
+
+        HazardPointers::clear(0);
+    }
+
+    /* Desencolar el nodo del frente, nullptr si la cola está vacía
+     * El nodo regresado pertenece a quien lo desencola.
+     * Complejidad: O(1) amortizado
+     */
+    Node<T> * dequeue()
+    {
+        Node<T> * node = nullptr;
+
+        while (true) {
+            Cell * head = HazardPointers::protect(0, _head);
+            Cell * tail = _tail.load();
+            Cell * next = HazardPointers::protect(1, head->getInfo().next);
+
+            if (head != _head.load()) { continue; }
+
+            if (next == nullptr) { break; }
+
+            if (head == tail) {
+                _tail.compare_exchange_weak(tail, next);
+                continue;
+            }
+
+            /* Leer la carga antes de que next pase a ser la celda ficticia */
+            Node<T> * payload = next->getInfo().node;
+
+            if (_head.compare_exchange_weak(head, next)) {
+                node = payload;
+                HazardPointers::clear(0);
+                HazardPointers::clear(1);
+                HazardPointers::retire<CellAllocator>(head);
+                return node;
+            }
+        }
+
+        HazardPointers::clear(0);
+        HazardPointers::clear(1);
+
+        return node;
+    }
+
+    /* Desencolar moviendo el valor; regresa false si la cola está vacía */
+    bool dequeue(T & value)
+    {
+        Node<T> * node = this->dequeue();
+        if (node == nullptr) { return false; }
+
+        value = std::move(node->getInfo());
+        Allocator::destroy(node);
+
+        return true;
+    }
+
+    /* Determinar si la cola está vacía (solo es exacto si nadie más la usa)
+     * head se protege como en dequeue: otro hilo puede retirarla mientras se lee
+     */
+    bool empty() const
+    {
+        Cell * head = HazardPointers::protect(0, _head);
+        bool none = head->getInfo().next.load() == nullptr;
+        HazardPointers::clear(0);
+
+        return none;
+    }
+};
+
+/* Pila LIFO sin candados (Treiber)
+ * push y pop hacen un compare-and-swap sobre el tope; HazardPointers evita
+ * que otro hilo libere o reutilice la celda del tope mientras se lee.
+ */
+template <class T, class Allocator = NodeAllocator<T>>
+class LockFreeStack {
+    typedef Node<ConcurrentCell<T>> Cell;
+    typedef typename Allocator::template rebind<ConcurrentCell<T>> CellAllocator;
+
+    std::atomic<Cell *> _top { nullptr };
+
+public:
+    LockFreeStack() { }
+
+    LockFreeStack(const LockFreeStack &) = delete;
+    LockFreeStack & operator =(const LockFreeStack &) = delete;
+
+    /* Destructor: no debe haber otros hilos usando la pila */
+    ~LockFreeStack()
+    {
+        while (Node<T> * node = this->pop()) {
+            Allocator::destroy(node);
+        }
+    }
+
+    /* Apilar un valor */
+    void push(const T & value) { this->push(Allocator::create(value)); }
+    void push(T && value) { this->push(Allocator::create(std::move(value))); }
+
+    /* Apilar un nodo existente
+     * Complejidad: O(1) amortizado
+     */
+    void push(Node<T> * node)
+    {
+        Cell * cell = CellAllocator::create(std::in_place, node);
+        Cell * top = _top.load();
+
+        do {
+            cell->getInfo().next.store(top);
+        } while (!_top.compare_exchange_weak(top, cell));
+    }
+
+    /* Desapilar el nodo del tope, nullptr si la pila está vacía
+     * Complejidad: O(1) amortizado
+     */
+    Node<T> * pop()
+    {
+        while (true) {
+            Cell * top = HazardPointers::protect(0, _top);
+
+            if (top == nullptr) { break; }
+
+            Cell * next = top->getInfo().next.load();
+
+            if (_top.compare_exchange_weak(top, next)) {
+                Node<T> * node = top->getInfo().node;
+                HazardPointers::clear(0);
+                HazardPointers::retire<CellAllocator>(top);
+                return node;
+            }
+        }
+
+        HazardPointers::clear(0);
+
+        return nullptr;
+    }
+
+    /* Desapilar moviendo el valor; regresa false si la pila está vacía */
+    bool pop(T & value)
+    {
+        Node<T> * node = this->pop();
+        if (node == nullptr) { return false; }
+
+        value = std::move(node->getInfo());
+        Allocator::destroy(node);
+
+        return true;
+    }
+
+    /* Determinar si la pila está vacía (solo es exacto si nadie más la usa) */
+    bool empty() const
+    {
+        return _top.load() == nullptr;
+    }
+};
+
+#endif /* LockFreeQueue_hpp */
@@ -0,0 +1,94 @@
+//
+//  Node.hpp
+//  LinkedList
+//
+//  Created by Developer on 18/10/26.
+//
+
+#ifndef Node_hpp
+#define Node_hpp
+
+#include <iostream>
+#include <utility>
+
+template <class T>
+class Node {
+    T info;
+    Node<T> * next = nullptr;
+
+public:
+    Node() { }
+    Node(const T & _info) : info(_info) { }
+    Node(T && _info) : info(std::move(_info)) { }
+
+    /* Construir el valor en su lugar con los argumentos de su constructor */
+    template <class... Args>
+    Node(std::in_place_t, Args &&... args) : info(std::forward<Args>(args)...) { }
+
+    virtual ~Node();
+
+    /* Obtener el valor sin copiarlo */
+    const T & getInfo() const;
+    T & getInfo();
+
+    void setInfo(const T &);
+    void setInfo(T &&);
+
+    Node<T> * getNext() const;
+    void setNext(Node<T> *);
+
+    template <typename Tn>
+    friend std::ostream & operator <<(std::ostream &, const Node<Tn> &);
+};
+
+template <class T>
+Node<T>::~Node()
+{
+    next = nullptr;
+}
+
+template <class T>
+const T & Node<T>::getInfo() const
+{
+    return info;
+}
+
+template <class T>
+T & Node<T>::getInfo()
+{
+    return info;
+}
+
+template <class T>
+void Node<T>::setInfo(const T & value)
+{
+    info = value;
+}
+
+template <class T>
+void Node<T>::setInfo(T && value)
+{
+    info = std::move(value);
+}
+
+template <class T>
+Node<T> * Node<T>::getNext() const
+{
+    return next;
+}
+
+template <class T>
+void Node<T>::setNext(Node<T> * value)
+{
+    next = value;
+}
+
+template <class T>
+std::ostream & operator <<(std::ostream & os, const Node<T> & node)
+{
+    os << node.info;
+
+    return os;
+}
+
+#endif /* Node_hpp */
@@ -0,0 +1,251 @@
+//
+//  NodePool.hpp
+//  LinkedList
+//
+//  Created by Developer on 18/10/26.
+//
+
+#ifndef NodePool_hpp
+#define NodePool_hpp
+
+#include <new>
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include "Node.hpp"
+
+/* Política de reserva original: cada nodo con new/delete */
+template <class T>
+struct NodeAllocator {
+    /* La misma política para nodos de otro tipo */
+    template <class U>
+    using rebind = NodeAllocator<U>;
+
+    template <class... Args>
+    static Node<T> * create(Args &&... args)
+    {
+        return new Node<T>(std::forward<Args>(args)...);
+    }
+
+    static void destroy(Node<T> * node)
+    {
+        delete node;
+    }
+
+    /* Liberar una cadena de nodos enlazados por next */
+    static void destroyChain(Node<T> * first)
+    {
+        while (first != nullptr) {
+            Node<T> * next = first->getNext();
+            delete first;
+            first = next;
+        }
+    }
+};
+
+/* Bloques de nodos por hilo con lista libre
+ * Cada hilo reserva nodos de bloques (slabs) grandes y contiguos, así que
+ * los nodos quedan cerca en memoria y casi nunca se llama a malloc.
+ * Cada ranura recuerda el pool que la reservó y un nodo liberado siempre
+ * regresa a ese pool: a su lista libre si lo libera el mismo hilo, o a una
+ * pila atómica de liberaciones remotas que el dueño recoge en grow(). Así,
+ * cuando un hilo produce nodos y otro los libera (una cola entre hilos), el
+ * productor reutiliza sus nodos en lugar de pedir bloques nuevos.
+ * Los bloques nunca se devuelven al sistema: cuando un hilo termina, su pool
+ * (con su lista libre) pasa a una reserva global y lo adopta un hilo nuevo.
+ * Nota: una lista con PoolNodeAllocator no debe tener duración estática,
+ * porque el pool del hilo principal se libera antes que ella
+ */
+template <class T>
+class NodePool {
+    struct Slot {
+        NodePool * owner;
+        union {
+            Slot * next;
+            alignas(Node<T>) unsigned char storage[sizeof(Node<T>)];
+        };
+    };
+
+    struct Orphans {
+        std::mutex mutex;
+        std::vector<NodePool *> pools;
+        std::vector<Slot *> slabs;
+    };
+
+    /* Pool del hilo; al terminar el hilo queda en la reserva global */
+    struct Handle {
+        NodePool * pool;
+
+        Handle() : pool(adopt()) {}
+
+        ~Handle()
+        {
+            Orphans & o = orphans();
+            std::lock_guard<std::mutex> lock(o.mutex);
+            o.pools.push_back(pool);
+        }
+    };
+
+    Slot * freeList = nullptr;                    /* solo la usa el hilo dueño */
+    std::atomic<Slot *> remoteFree { nullptr };   /* liberadas por otros hilos */
+    std::size_t slabSize = 64;
+
+    static Orphans & orphans()
+    {
+        static Orphans * shared = new Orphans();
+        return *shared;
+    }
+
+    /* Tomar el pool de un hilo que ya terminó, o crear uno */
+    static NodePool * adopt()
+    {
+        {
+            Orphans & o = orphans();
+            std::lock_guard<std::mutex> lock(o.mutex);
+            if (!o.pools.empty()) {
+                NodePool * pool = o.pools.back();
+                o.pools.pop_back();
+                return pool;
+            }
+        }
+        return new NodePool();
+    }
+
+    static Slot * slotOf(Node<T> * node)
+    {
+        return reinterpret_cast<Slot *>(reinterpret_cast<unsigned char *>(node) - offsetof(Slot, storage));
+    }
+
+    /* Empalmar la cadena first..last en la pila remota de este pool */
+    void pushRemote(Slot * first, Slot * last)
+    {
+        Slot * head = remoteFree.load(std::memory_order_relaxed);
+        do {
+            last->next = head;
+        } while (!remoteFree.compare_exchange_weak(head, first, std::memory_order_release,
+                                                   std::memory_order_relaxed));
+    }
+
+    /* Regresar la cadena first..last a su dueño */
+    void release(Slot * first, Slot * last)
+    {
+        if (first->owner == this) {
+            last->next = freeList;
+            freeList = first;
+        } else {
+            first->owner->pushRemote(first, last);
+        }
+    }
+
+    /* Recoger lo que liberaron otros hilos o reservar un bloque nuevo */
+    void grow()
+    {
+        /* Se toma la pila completa de una vez, así que no hay problema ABA */
+        freeList = remoteFree.exchange(nullptr, std::memory_order_acquire);
+        if (freeList != nullptr) { return; }
+
+        Slot * slab = static_cast<Slot *>(::operator new(slabSize * sizeof(Slot)));
+
+        for (std::size_t i = 0; i < slabSize; ++i) {
+            slab[i].owner = this;
+            slab[i].next = (i + 1 < slabSize) ? &slab[i + 1] : nullptr;
+        }
+        freeList = slab;
+
+        {
+            Orphans & o = orphans();
+            std::lock_guard<std::mutex> lock(o.mutex);
+            o.slabs.push_back(slab);
+        }
+
+        /* Los bloques crecen al doble hasta 64K nodos */
+        if (slabSize < 65536) { slabSize *= 2; }
+    }
+
+    NodePool() {}
+
+public:
+    NodePool(const NodePool &) = delete;
+    NodePool & operator =(const NodePool &) = delete;
+
+    /* Obtener el pool del hilo actual */
+    static NodePool & local()
+    {
+        thread_local Handle handle;
+        return *handle.pool;
+    }
+
+    template <class... Args>
+    Node<T> * create(Args &&... args)
+    {
+        if (freeList == nullptr) { grow(); }
+
+        Slot * slot = freeList;
+        freeList = slot->next;
+
+        return new (slot->storage) Node<T>(std::forward<Args>(args)...);
+    }
+
+    void destroy(Node<T> * node)
+    {
+        Slot * slot = slotOf(node);
+        node->~Node<T>();
+        this->release(slot, slot);
+    }
+
+    /* Destruir una cadena de nodos; los tramos seguidos del mismo dueño
+     * regresan a él con un solo empalme
+     */
+    void destroyChain(Node<T> * first)
+    {
+        Slot * head = nullptr;
+        Slot * tail = nullptr;
+
+        while (first != nullptr) {
+            Node<T> * next = first->getNext();
+            Slot * slot = slotOf(first);
+            first->~Node<T>();
+
+            if (head != nullptr && slot->owner != head->owner) {
+                this->release(head, tail);
+                head = nullptr;
+            }
+
+            slot->next = head;
+            if (head == nullptr) { tail = slot; }
+            head = slot;
+
+            first = next;
+        }
+
+        if (head != nullptr) { this->release(head, tail); }
+    }
+};
+
+/* Política de reserva con el pool por hilo */
+template <class T>
+struct PoolNodeAllocator {
+    /* La misma política para nodos de otro tipo */
+    template <class U>
+    using rebind = PoolNodeAllocator<U>;
+
+    template <class... Args>
+    static Node<T> * create(Args &&... args)
+    {
+        return NodePool<T>::local().create(std::forward<Args>(args)...);
+    }
+
+    static void destroy(Node<T> * node)
+    {
+        NodePool<T>::local().destroy(node);
+    }
+
+    static void destroyChain(Node<T> * first)
+    {
+        NodePool<T>::local().destroyChain(first);
+    }
+};
+
+#endif /* NodePool_hpp */
@@ -0,0 +1,318 @@
+//
+//  PersistentList.hpp
+//  LinkedList
+//
+//  Created by Developer on 18/10/26.
+//
+
+#ifndef PersistentList_hpp
+#define PersistentList_hpp
+
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <vector>
+#include <utility>
+#include <initializer_list>
+#include <cstddef>
+#include "LinkedList.hpp"
+
+/* Lista persistente (inmutable) con colas compartidas
+ * Ninguna operación modifica una versión existente: insert_front y
+ * remove_front regresan una versión nueva que comparte el resto de los nodos,
+ * y clone() solo copia un apuntador. Los nodos se liberan por conteo de
+ * referencias cuando ya ninguna versión los usa.
+ * Un lector puede recorrer su versión mientras otros hilos crean versiones
+ * nuevas sin copiar ni bloquear; lo que no debe compartirse sin sincronizar
+ * es un mismo objeto PersistentList que se reasigna.
+ */
+template <class T>
+class PersistentList {
+    struct Cell {
+        T value;
+        std::shared_ptr<Cell> next;
+
+        Cell(const T & _value, std::shared_ptr<Cell> _next) : value(_value), next(std::move(_next)) {}
+        Cell(T && _value, std::shared_ptr<Cell> _next) : value(std::move(_value)), next(std::move(_next)) {}
+
+        /* Liberar la cola de forma iterativa: con una cola larga la
+         * destrucción recursiva agotaría la pila
+         */
+        ~Cell()
+        {
+            while (next && next.use_count() == 1) {
+                next = std::move(next->next);
+            }
+        }
+    };
+
+    std::shared_ptr<Cell> _head;
+    int _size = 0;
+
+    PersistentList(std::shared_ptr<Cell> head, int size) : _head(std::move(head)), _size(size) {}
+
+    /* Copiar los primeros count nodos y colgar de la copia la cola rest */
+    static std::shared_ptr<Cell> copyPrefix(const Cell *, int, std::shared_ptr<Cell>);
+
+public:
+    /* Iterador constante: las versiones no se modifican */
+    class const_iterator {
+        const Cell * _cell = nullptr;
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const T * pointer;
+        typedef const T & reference;
+
+        const_iterator() {}
+        const_iterator(const Cell * _acell) : _cell(_acell) {}
+
+        reference operator *() const { return _cell->value; }
+        pointer operator ->() const { return &_cell->value; }
+        const_iterator & operator ++() { _cell = _cell->next.get(); return *this; }
+        const_iterator operator ++(int) { const_iterator tmp = *this; ++*this; return tmp; }
+        bool operator == (const const_iterator & it) const { return _cell == it._cell; }
+        bool operator != (const const_iterator & it) const { return _cell != it._cell; }
+    };
+
+    typedef const_iterator iterator;
+
+    /* Constructor */
+    PersistentList() { }
+
+    PersistentList(std::initializer_list<T>);
+
+    /* Tomar una instantánea de una LinkedList */
+    template <class Allocator>
+    explicit PersistentList(const LinkedList<T, Allocator> &);
+
+    /* Obtener el tamaño de la lista */
+    int size() const { return _size; }
+
+    /* Determinar si la lista está vacía */
+    bool empty() const { return _size == 0; }
+
+    /* Obtener el primer elemento; la lista no debe estar vacía */
+    const T & front() const { return _head->value; }
+
+    /* Versión con un elemento más al inicio
+     * Complejidad: O(1)
+     */
+    PersistentList insert_front(const T & value) const { return { std::make_shared<Cell>(value, _head), _size + 1 }; }
+    PersistentList insert_front(T && value) const { return { std::make_shared<Cell>(std::move(value), _head), _size + 1 }; }
+
+    /* Versión sin el primer elemento
+     * Complejidad: O(1)
+     */
+    PersistentList remove_front() const { return empty() ? *this : PersistentList(_head->next, _size - 1); }
+
+    /* Versión con value en position; copia los nodos anteriores */
+    PersistentList insert(const T &, int) const;
+
+    /* Versión sin el elemento en position; copia los nodos anteriores */
+    PersistentList remove(int) const;
+
+    /* Versión con un elemento más al final; copia toda la lista */
+    PersistentList insert_back(const T & value) const { return this->insert(value, _size); }
+
+    /* Clonar una lista: las versiones comparten todos los nodos
+     * Complejidad: O(1)
+     */
+    PersistentList clone() const { return *this; }
+
+    /* Versión invertida */
+    PersistentList reverse() const;
+
+    /* Obtener el elemento que se encuentra en una posición, nullptr si no existe */
+    const T * at(int) const;
+
+    /* Obtener la posición de un valor */
+    int index(const T &) const;
+
+    /* Obtener la cantidad de ocurrencias de un elemento */
+    int count(const T &) const;
+
+    /* Determinar si dos versiones son la misma (comparten la cabeza) */
+    bool sameVersion(const PersistentList & other) const { return _head == other._head; }
+
+    /* Funciones que utiliza el foreach
+     * Complejidad: O(1)
+     */
+    const_iterator begin() const { return { _head.get() }; }
+    const_iterator end() const { return { nullptr }; }
+    const_iterator cbegin() const { return { _head.get() }; }
+    const_iterator cend() const { return { nullptr }; }
+
+    /* Mostrar el contenido de la lista */
+    template <typename Tn>
+    friend std::ostream & operator <<(std::ostream &, const PersistentList<Tn> &);
+};
+
+/* Construir de atrás hacia adelante
+ * Complejidad: O(n)
+ */
+template <class T>
+PersistentList<T>::PersistentList(std::initializer_list<T> values)
+{
+    for (auto it = values.end(); it != values.begin(); ) {
+        --it;
+        _head = std::make_shared<Cell>(*it, std::move(_head));
+    }
+
+    _size = (int) values.size();
+}
+
+/* Complejidad: O(n) */
+template <class T>
+template <class Allocator>
+PersistentList<T>::PersistentList(const LinkedList<T, Allocator> & list)
+{
+    std::vector<const T *> values;
+    values.reserve(list.size());
+
+    for (const Node<T> & node : list) {
+        values.push_back(&node.getInfo());
+    }
+
+    for (auto it = values.rbegin(); it != values.rend(); ++it) {
+        _head = std::make_shared<Cell>(**it, std::move(_head));
+    }
+
+    _size = (int) values.size();
+}
+
+/* Complejidad: O(count) */
+template <class T>
+std::shared_ptr<typename PersistentList<T>::Cell> PersistentList<T>::copyPrefix(const Cell * cell, int count, std::shared_ptr<Cell> rest)
+{
+    if (count == 0) { return rest; }
+
+    /* Copiar en orden y enlazar cada copia con la siguiente */
+    std::shared_ptr<Cell> head = std::make_shared<Cell>(cell->value, nullptr);
+    Cell * last = head.get();
+
+    for (int i = 1; i < count; ++i) {
+        cell = cell->next.get();
+        last->next = std::make_shared<Cell>(cell->value, nullptr);
+        last = last->next.get();
+    }
+
+    last->next = std::move(rest);
+
+    return head;
+}
+
+/* Insertar en una posición
+ * Complejidad: O(position); los nodos después de position se comparten
+ */
+template <class T>
+PersistentList<T> PersistentList<T>::insert(const T & value, int position) const
+{
+    if (position <= 0) { return this->insert_front(value); }
+    if (position > _size) { position = _size; }
+
+    /* Encontrar el nodo que quedará después del nuevo */
+    std::shared_ptr<Cell> rest = _head;
+    for (int i = 0; i < position; ++i) {
+        rest = rest->next;
+    }
+
+    rest = std::make_shared<Cell>(value, std::move(rest));
+
+    return { copyPrefix(_head.get(), position, std::move(rest)), _size + 1 };
+}
+
+/* Eliminar en una posición
+ * Complejidad: O(position); los nodos después de position se comparten
+ */
+template <class T>
+PersistentList<T> PersistentList<T>::remove(int position) const
+{
+    if (position < 0 || position >= _size) { return *this; }
+
+    std::shared_ptr<Cell> rest = _head;
+    for (int i = 0; i <= position; ++i) {
+        rest = rest->next;
+    }
+
+    return { copyPrefix(_head.get(), position, std::move(rest)), _size - 1 };
+}
+
+/* Invertir una lista
+ * Complejidad: O(n), no se comparte ningún nodo
+ */
+template <class T>
+PersistentList<T> PersistentList<T>::reverse() const
+{
+    std::shared_ptr<Cell> head;
+
+    for (const T & value : *this) {
+        head = std::make_shared<Cell>(value, std::move(head));
+    }
+
+    return { std::move(head), _size };
+}
+
+/* Obtener el elemento que se encuentra en una posición
+ * Complejidad: O(n)
+ */
+template <class T>
+const T * PersistentList<T>::at(int position) const
+{
+    if (position < 0 || position >= _size) { return nullptr; }
+
+    const Cell * cell = _head.get();
+    while (position-- > 0) {
+        cell = cell->next.get();
+    }
+
+    return &cell->value;
+}
+
+/* Obtener la posición de un valor
+ * Complejidad: O(n)
+ */
+template <class T>
+int PersistentList<T>::index(const T & value) const
+{
+    int position = 0;
+
+    for (const T & item : *this) {
+        if (item == value) { return position; }
+        ++position;
+    }
+
+    return -1;
+}
+
+/* Obtener la cantidad de ocurrencias de un elemento
+ * Complejidad: O(n)
+ */
+template <class T>
+int PersistentList<T>::count(const T & value) const
+{
+    int total = 0;
+
+    for (const T & item : *this) {
+        if (item == value) { ++total; }
+    }
+
+    return total;
+}
+
+/* Mostrar el contenido de la lista
+ * Complejidad: O(n)
+ */
+template <class T>
+std::ostream & operator <<(std::ostream & os, const PersistentList<T> & list)
+{
+    for (const T & value : list) {
+        os << value << " ";
+    }
+
+    return os;
+}
+
+#endif /* PersistentList_hpp */
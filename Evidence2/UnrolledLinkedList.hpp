@@ -0,0 +1,831 @@
+//
+//  UnrolledLinkedList.hpp
+//  LinkedList
+//
+//  Created by Developer on 18/10/26.
+//
+
+#ifndef UnrolledLinkedList_hpp
+#define UnrolledLinkedList_hpp
+
+#include <iostream>
+#include <iterator>
+#include <algorithm>
+#include <type_traits>
+#include <initializer_list>
+#include <new>
+#include <cstddef>
+#include "LinkedList.hpp"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/* Capacidad por omisión de un bloque: unas cuatro líneas de caché de elementos */
+template <class T>
+constexpr int unrolledCapacity()
+{
+    return sizeof(T) >= 64 ? 4 : (int) (256 / sizeof(T));
+}
+
+/* Lista ligada desenrollada
+ * Cada nodo (bloque) guarda hasta Capacity elementos contiguos, así que
+ * recorrer la lista cuesta un fallo de caché por bloque y no por elemento.
+ * Insertar en medio solo desplaza los elementos de un bloque: si está lleno
+ * se divide a la mitad, y un bloque que queda con menos de la mitad al
+ * eliminar toma elementos del siguiente o se fusiona con él. Así todos los
+ * bloques, salvo el último, están al menos a la mitad.
+ * A diferencia de LinkedList los elementos no viven en Node<T>: at() regresa
+ * un apuntador al valor y remove() indica si se eliminó algo.
+ * Nota: los apuntadores a elementos se invalidan al insertar o eliminar
+ */
+template <class T, int Capacity = unrolledCapacity<T>()>
+class UnrolledLinkedList {
+    static_assert(Capacity >= 4, "Un bloque debe tener al menos 4 elementos");
+
+protected:
+    struct Chunk {
+        Chunk * next = nullptr;
+        int count = 0;
+        alignas(T) unsigned char storage[Capacity * sizeof(T)];
+
+        T * items() { return std::launder(reinterpret_cast<T *>(storage)); }
+        const T * items() const { return std::launder(reinterpret_cast<const T *>(storage)); }
+    };
+
+    Chunk * _first = nullptr;
+    Chunk * _last = nullptr;
+    int _size = 0;
+
+    /* Enlazar un bloque vacío después de previous (al inicio si es nullptr) */
+    Chunk * linkChunkAfter(Chunk *);
+
+    /* Desenlazar y liberar el bloque que sigue a previous */
+    Chunk * unlinkChunkAfter(Chunk *, Chunk *);
+
+    /* Encontrar el bloque de una posición; offset queda dentro del bloque */
+    Chunk * locate(int, int &, Chunk ** = nullptr) const;
+
+    /* Insertar en un bloque, dividiéndolo si está lleno */
+    void insertAt(Chunk *, int, T &&);
+
+    /* Insertar al final llenando el último bloque */
+    void pushBack(T &&);
+
+    /* Mover la mitad superior de un bloque lleno a uno nuevo */
+    void split(Chunk *);
+
+    /* Recuperar el invariante de llenado después de eliminar */
+    void rebalance(Chunk *, Chunk *);
+
+    /* Eliminar count elementos desde position; si into no es nullptr se mueven ahí */
+    void eraseRange(int, int, UnrolledLinkedList *);
+
+    /* Contar o encontrar un valor dentro de un bloque */
+    static int countIn(const T *, int, const T &);
+    static int findIn(const T *, int, const T &);
+
+    /* Iterador sobre los elementos (C y V son constantes en el iterador constante) */
+    template <class C, class V>
+    class ChunkIterator {
+        C * _chunk = nullptr;
+        int _offset = 0;
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef V * pointer;
+        typedef V & reference;
+
+        ChunkIterator() {}
+        ChunkIterator(C * _achunk, int _anoffset = 0) : _chunk(_achunk), _offset(_anoffset) {}
+
+        /* Un iterador mutable se puede usar donde se espera uno constante */
+        operator ChunkIterator<const C, const V>() const { return { _chunk, _offset }; }
+
+        reference operator *() const { return _chunk->items()[_offset]; }
+        pointer operator ->() const { return _chunk->items() + _offset; }
+
+        ChunkIterator & operator ++()
+        {
+            if (++_offset == _chunk->count) {
+                _chunk = _chunk->next;
+                _offset = 0;
+            }
+            return *this;
+        }
+
+        ChunkIterator operator ++(int) { ChunkIterator tmp = *this; ++*this; return tmp; }
+
+        bool operator == (const ChunkIterator & it) const { return _chunk == it._chunk && _offset == it._offset; }
+        bool operator != (const ChunkIterator & it) const { return !(*this == it); }
+    };
+
+public:
+    typedef ChunkIterator<Chunk, T> iterator;
+    typedef ChunkIterator<const Chunk, const T> const_iterator;
+
+    /* Constructor */
+    UnrolledLinkedList() { }
+
+    UnrolledLinkedList(std::initializer_list<T>);
+
+    /* Las copias se hacen con clone() */
+    UnrolledLinkedList(const UnrolledLinkedList &) = delete;
+    UnrolledLinkedList & operator =(const UnrolledLinkedList &) = delete;
+
+    /* Destructor */
+    virtual ~UnrolledLinkedList();
+
+    /* Obtener el tamaño de la lista */
+    int size() const { return _size; }
+
+    /* Determinar si la lista está vacía */
+    bool empty() const { return _size == 0; }
+
+    /* Insertar un elemento en una posición dada */
+    void insert(const T &, int);
+
+    /* Insertar un elemento al inicio */
+    void insert_front(const T &);
+
+    /* Insertar un elemento al final */
+    void insert_back(const T &);
+
+    /* Eliminar el elemento en una posición; regresa false si no existe */
+    bool remove(int);
+
+    /* Eliminar el primer elemento */
+    bool remove_front();
+
+    /* Eliminar el último elemento */
+    bool remove_back();
+
+    /* Eliminar todos los elementos de la lista y liberar la memoria ocupada */
+    virtual void clear();
+
+    /* Obtener el elemento que se encuentra en una posición, nullptr si no existe */
+    T * at(int) const;
+
+    /* Obtener la posición de un valor */
+    virtual int index(const T &) const;
+
+    /* Obtener la cantidad de ocurrencias de un elemento */
+    virtual int count(const T &) const;
+
+    /* Invertir una lista */
+    virtual void reverse();
+
+    /* Mostrar el contenido de la lista */
+    template <typename Tn, int Cn>
+    friend std::ostream & operator <<(std::ostream &, const UnrolledLinkedList<Tn, Cn> &);
+
+    /* Funciones que utiliza el foreach
+     * Complejidad: O(1)
+     */
+    iterator begin() { return { _first }; }
+    iterator end() { return { nullptr }; }
+    const_iterator begin() const { return { _first }; }
+    const_iterator end() const { return { nullptr }; }
+    const_iterator cbegin() const { return { _first }; }
+    const_iterator cend() const { return { nullptr }; }
+
+    /* Sobrecarga del operador índice */
+    T * operator [](const int position) { return this->at(position); }
+
+    /* Clonar una lista */
+    UnrolledLinkedList * clone() const;
+
+    /* Eliminar un rango de elementos */
+    void deleteRange(int, int);
+
+    /* Obtener un subconjunto de elementos (se mueven fuera de esta lista) */
+    UnrolledLinkedList * subList(int, int);
+
+    /* Operaciones de conjuntos con la misma semántica que LinkedList */
+    UnrolledLinkedList * Union(UnrolledLinkedList *, SetSemantics = SetSemantics::Set) const;
+    UnrolledLinkedList * Intersection(UnrolledLinkedList *, SetSemantics = SetSemantics::Set) const;
+    UnrolledLinkedList * Except(UnrolledLinkedList *, SetSemantics = SetSemantics::Set) const;
+
+protected:
+    ValueCounter<T> countValues() const;
+};
+
+template <class T, int Capacity>
+UnrolledLinkedList<T, Capacity>::UnrolledLinkedList(std::initializer_list<T> values)
+{
+    for (const T & value : values) {
+        this->insert_back(value);
+    }
+}
+
+template <class T, int Capacity>
+UnrolledLinkedList<T, Capacity>::~UnrolledLinkedList()
+{
+    this->clear();
+}
+
+/* Complejidad: O(1) */
+template <class T, int Capacity>
+typename UnrolledLinkedList<T, Capacity>::Chunk * UnrolledLinkedList<T, Capacity>::linkChunkAfter(Chunk * previous)
+{
+    Chunk * chunk = new Chunk();
+
+    if (previous == nullptr) {
+        chunk->next = _first;
+        _first = chunk;
+    }
+    else {
+        chunk->next = previous->next;
+        previous->next = chunk;
+    }
+
+    if (chunk->next == nullptr) { _last = chunk; }
+
+    return chunk;
+}
+
+/* Complejidad: O(1); el bloque ya no debe tener elementos */
+template <class T, int Capacity>
+typename UnrolledLinkedList<T, Capacity>::Chunk * UnrolledLinkedList<T, Capacity>::unlinkChunkAfter(Chunk * previous, Chunk * chunk)
+{
+    Chunk * next = chunk->next;
+
+    if (previous == nullptr) { _first = next; }
+    else { previous->next = next; }
+
+    if (_last == chunk) { _last = previous; }
+
+    delete chunk;
+
+    return next;
+}
+
+/* Encontrar el bloque que contiene position
+ * Complejidad: O(n / Capacity)
+ */
+template <class T, int Capacity>
+typename UnrolledLinkedList<T, Capacity>::Chunk * UnrolledLinkedList<T, Capacity>::locate(int position, int & offset, Chunk ** previous) const
+{
+    Chunk * prev = nullptr;
+    Chunk * chunk = _first;
+
+    /* Saltar bloques completos sin tocar sus elementos */
+    while (chunk != nullptr && position >= chunk->count) {
+        position -= chunk->count;
+        prev = chunk;
+        chunk = chunk->next;
+    }
+
+    offset = position;
+    if (previous != nullptr) { *previous = prev; }
+
+    return chunk;
+}
+
+/* Dividir un bloque lleno
+ * Complejidad: O(Capacity)
+ */
+template <class T, int Capacity>
+void UnrolledLinkedList<T, Capacity>::split(Chunk * chunk)
+{
+    Chunk * upper = this->linkChunkAfter(chunk);
+    int half = chunk->count / 2;
+
+    T * from = chunk->items();
+    T * to = upper->items();
+
+    for (int i = half; i < chunk->count; ++i) {
+        new (to + (i - half)) T(std::move(from[i]));
+        from[i].~T();
+    }
+
+    upper->count = chunk->count - half;
+    chunk->count = half;
+}
+
+/* Insertar value en offset dentro de chunk
+ * Complejidad: O(Capacity)
+ */
+template <class T, int Capacity>
+void UnrolledLinkedList<T, Capacity>::insertAt(Chunk * chunk, int offset, T && value)
+{
+    if (chunk->count == Capacity) {
+        this->split(chunk);
+
+        /* Continuar en la mitad que le corresponde */
+        if (offset > chunk->count) {
+            offset -= chunk->count;
+            chunk = chunk->next;
+        }
+    }
+
+    T * items = chunk->items();
+
+    if (offset == chunk->count) {
+        new (items + offset) T(std::move(value));
+    }
+    else {
+        /* Recorrer los elementos un lugar a la derecha */
+        new (items + chunk->count) T(std::move(items[chunk->count - 1]));
+        for (int i = chunk->count - 1; i > offset; --i) {
+            items[i] = std::move(items[i - 1]);
+        }
+        items[offset] = std::move(value);
+    }
+
+    ++chunk->count;
+    ++_size;
+}
+
+/* Insertar un elemento en una posición dada
+ * Complejidad: O(n / Capacity + Capacity)
+ */
+template <class T, int Capacity>
+void UnrolledLinkedList<T, Capacity>::insert(const T & value, int position)
+{
+    T copy(value);
+
+    if (position >= _size) {
+        this->pushBack(std::move(copy));
+        return;
+    }
+
+    if (position < 0) { position = 0; }
+
+    int offset;
+    Chunk * chunk = this->locate(position, offset);
+
+    this->insertAt(chunk, offset, std::move(copy));
+}
+
+/* Llenar el último bloque y abrir otro solo cuando esté lleno
+ * Complejidad: O(1)
+ */
+template <class T, int Capacity>
+void UnrolledLinkedList<T, Capacity>::pushBack(T && value)
+{
+    Chunk * chunk = (_last == nullptr || _last->count == Capacity) ? this->linkChunkAfter(_last) : _last;
+
+    new (chunk->items() + chunk->count) T(std::move(value));
+    ++chunk->count;
+    ++_size;
+}
+
+/* Complejidad: O(Capacity) */
+template <class T, int Capacity>
+void UnrolledLinkedList<T, Capacity>::insert_front(const T & value)
+{
+    this->insert(value, 0);
+}
+
+/* Complejidad: O(1) amortizado */
+template <class T, int Capacity>
+void UnrolledLinkedList<T, Capacity>::insert_back(const T & value)
+{
+    this->insert(value, _size);
+}
+
+/* Recuperar el invariante después de eliminar elementos de chunk
+ * Un bloque vacío se libera. Uno con menos de la mitad se fusiona con el
+ * siguiente si caben juntos; si no, toma del inicio del siguiente los
+ * elementos que le faltan para llegar a la mitad. Como juntos pasan de
+ * Capacity, al siguiente le quedan más de la mitad.
+ * Complejidad: O(Capacity)
+ */
+template <class T, int Capacity>
+void UnrolledLinkedList<T, Capacity>::rebalance(Chunk * previous, Chunk * chunk)
+{
+    if (chunk->count == 0) {
+        this->unlinkChunkAfter(previous, chunk);
+        return;
+    }
+
+    Chunk * next = chunk->next;
+
+    if (chunk->count >= Capacity / 2 || next == nullptr) { return; }
+
+    T * items = chunk->items();
+    T * nextItems = next->items();
+
+    if (chunk->count + next->count > Capacity) {
+        /* Tomar prestados los primeros elementos del siguiente */
+        int borrowed = Capacity / 2 - chunk->count;
+
+        for (int i = 0; i < borrowed; ++i) {
+            new (items + chunk->count + i) T(std::move(nextItems[i]));
+        }
+        chunk->count += borrowed;
+
+        for (int i = borrowed; i < next->count; ++i) {
+            nextItems[i - borrowed] = std::move(nextItems[i]);
+        }
+        for (int i = next->count - borrowed; i < next->count; ++i) {
+            nextItems[i].~T();
+        }
+        next->count -= borrowed;
+        return;
+    }
+
+    /* Fusionar: caben ambos en un bloque */
+    for (int i = 0; i < next->count; ++i) {
+        new (items + chunk->count + i) T(std::move(nextItems[i]));
+        nextItems[i].~T();
+    }
+
+    chunk->count += next->count;
+    next->count = 0;
+
+    this->unlinkChunkAfter(chunk, next);
+}
+
+/* Eliminar el elemento en la posición dada
+ * Complejidad: O(n / Capacity + Capacity)
+ */
+template <class T, int Capacity>
+bool UnrolledLinkedList<T, Capacity>::remove(int position)
+{
+    /* Cuando la lista está vacía o position es inválida */
+    if (position < 0 || position >= _size) { return false; }
+
+    this->eraseRange(position, 1, nullptr);
+
+    return true;
+}
+
+/* Complejidad: O(Capacity) */
+template <class T, int Capacity>
+bool UnrolledLinkedList<T, Capacity>::remove_front()
+{
+    return this->remove(0);
+}
+
+/* Complejidad: O(n / Capacity), hay que encontrar el bloque anterior al último */
+template <class T, int Capacity>
+bool UnrolledLinkedList<T, Capacity>::remove_back()
+{
+    return this->remove(_size - 1);
+}
+
+/* Eliminar count elementos a partir de position
+ * Los bloques intermedios se vacían completos; al final solo se rebalancean
+ * los bloques donde empieza y termina el rango.
+ * Complejidad: O(n / Capacity + count)
+ */
+template <class T, int Capacity>
+void UnrolledLinkedList<T, Capacity>::eraseRange(int position, int count, UnrolledLinkedList * into)
+{
+    Chunk * previous;
+    int offset;
+    Chunk * chunk = this->locate(position, offset, &previous);
+
+    /* Bloques donde empieza y termina el rango, con sus anteriores */
+    Chunk * start = chunk;
+    Chunk * beforeStart = previous;
+    Chunk * end = nullptr;
+    Chunk * beforeEnd = nullptr;
+
+    while (count > 0 && chunk != nullptr) {
+        T * items = chunk->items();
+        int k = std::min(count, chunk->count - offset);
+
+        for (int i = offset; i < offset + k; ++i) {
+            if (into != nullptr) { into->pushBack(std::move(items[i])); }
+        }
+
+        /* Recorrer la cola del bloque sobre el hueco */
+        for (int i = offset + k; i < chunk->count; ++i) {
+            items[i - k] = std::move(items[i]);
+        }
+        for (int i = chunk->count - k; i < chunk->count; ++i) {
+            items[i].~T();
+        }
+
+        chunk->count -= k;
+        _size -= k;
+        count -= k;
+
+        if (chunk->count == 0 && chunk != start) {
+            chunk = this->unlinkChunkAfter(previous, chunk);
+        }
+        else {
+            if (chunk != start) {
+                end = chunk;
+                beforeEnd = previous;
+            }
+            previous = chunk;
+            chunk = chunk->next;
+        }
+        offset = 0;
+    }
+
+    /* Solo los extremos del rango pueden quedar a menos de la mitad */
+    if (end != nullptr) { this->rebalance(beforeEnd, end); }
+    this->rebalance(beforeStart, start);
+}
+
+/* Eliminar todos los elementos de la lista y liberar la memoria ocupada
+ * Complejidad: O(n)
+ */
+template <class T, int Capacity>
+void UnrolledLinkedList<T, Capacity>::clear()
+{
+    Chunk * chunk = _first;
+
+    while (chunk != nullptr) {
+        Chunk * next = chunk->next;
+
+        T * items = chunk->items();
+        for (int i = 0; i < chunk->count; ++i) { items[i].~T(); }
+        delete chunk;
+
+        chunk = next;
+    }
+
+    _first = nullptr;
+    _last = nullptr;
+    _size = 0;
+}
+
+/* Obtener el elemento que se encuentra en una posición
+ * Complejidad: O(n / Capacity)
+ */
+template <class T, int Capacity>
+T * UnrolledLinkedList<T, Capacity>::at(int position) const
+{
+    if (position < 0 || position >= _size) { return nullptr; }
+
+    int offset;
+    Chunk * chunk = this->locate(position, offset);
+
+    return chunk->items() + offset;
+}
+
+/* Contar value en un bloque
+ * Para enteros de 32 bits se comparan 4 elementos por instrucción con SSE2;
+ * para otros tipos aritméticos el ciclo sin saltos lo vectoriza el compilador.
+ * Complejidad: O(n)
+ */
+template <class T, int Capacity>
+int UnrolledLinkedList<T, Capacity>::countIn(const T * items, int n, const T & value)
+{
+    int i = 0;
+    int total = 0;
+
+#ifdef __SSE2__
+    if constexpr (std::is_integral<T>::value && sizeof(T) == 4) {
+        const __m128i key = _mm_set1_epi32((int) value);
+        __m128i sum = _mm_setzero_si128();
+
+        /* Cada coincidencia vale -1 en su carril */
+        for (; i + 4 <= n; i += 4) {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(items + i));
+            sum = _mm_sub_epi32(sum, _mm_cmpeq_epi32(block, key));
+        }
+
+        alignas(16) int lanes[4];
+        _mm_store_si128(reinterpret_cast<__m128i *>(lanes), sum);
+        total = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    }
+#endif
+
+    if constexpr (std::is_arithmetic<T>::value) {
+        for (; i < n; ++i) { total += items[i] == value; }
+    }
+    else {
+        for (; i < n; ++i) {
+            if (items[i] == value) { ++total; }
+        }
+    }
+
+    return total;
+}
+
+/* Encontrar la primera posición de value en un bloque, -1 si no está
+ * Complejidad: O(n)
+ */
+template <class T, int Capacity>
+int UnrolledLinkedList<T, Capacity>::findIn(const T * items, int n, const T & value)
+{
+    int i = 0;
+
+#ifdef __SSE2__
+    if constexpr (std::is_integral<T>::value && sizeof(T) == 4) {
+        const __m128i key = _mm_set1_epi32((int) value);
+
+        for (; i + 4 <= n; i += 4) {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(items + i));
+            int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block, key)));
+
+            if (mask != 0) {
+                for (int k = 0; k < 4; ++k) {
+                    if (mask & (1 << k)) { return i + k; }
+                }
+            }
+        }
+    }
+#endif
+
+    for (; i < n; ++i) {
+        if (items[i] == value) { return i; }
+    }
+
+    return -1;
+}
+
+/* Obtener la posición de un valor
+ * Complejidad: O(n)
+ */
+template <class T, int Capacity>
+int UnrolledLinkedList<T, Capacity>::index(const T & value) const
+{
+    int base = 0;
+
+    for (Chunk * chunk = _first; chunk != nullptr; chunk = chunk->next) {
+        int found = findIn(chunk->items(), chunk->count, value);
+        if (found >= 0) { return base + found; }
+        base += chunk->count;
+    }
+
+    return -1;
+}
+
+/* Obtener la cantidad de ocurrencias de un elemento
+ * Complejidad: O(n)
+ */
+template <class T, int Capacity>
+int UnrolledLinkedList<T, Capacity>::count(const T & value) const
+{
+    int total = 0;
+
+    for (Chunk * chunk = _first; chunk != nullptr; chunk = chunk->next) {
+        total += countIn(chunk->items(), chunk->count, value);
+    }
+
+    return total;
+}
+
+/* Invertir el orden de los bloques y el de cada bloque
+ * Complejidad: O(n)
+ */
+template <class T, int Capacity>
+void UnrolledLinkedList<T, Capacity>::reverse()
+{
+    Chunk * previous = nullptr;
+    Chunk * chunk = _first;
+
+    _last = _first;
+
+    while (chunk != nullptr) {
+        std::reverse(chunk->items(), chunk->items() + chunk->count);
+
+        Chunk * next = chunk->next;
+        chunk->next = previous;
+        previous = chunk;
+        chunk = next;
+    }
+
+    _first = previous;
+}
+
+/* Mostrar el contenido de la lista
+ * Complejidad: O(n)
+ */
+template <class T, int Capacity>
+std::ostream & operator <<(std::ostream & os, const UnrolledLinkedList<T, Capacity> & list)
+{
+    for (const T & value : list) {
+        os << value << " ";
+    }
+
+    return os;
+}
+
+/* Clonar una lista; la copia queda con bloques llenos
+ * Complejidad: O(n)
+ */
+template <class T, int Capacity>
+UnrolledLinkedList<T, Capacity> * UnrolledLinkedList<T, Capacity>::clone() const
+{
+    UnrolledLinkedList * list = new UnrolledLinkedList();
+
+    for (const T & value : *this) {
+        list->insert_back(value);
+    }
+
+    return list;
+}
+
+/* Eliminar un rango de elementos
+ * Complejidad: O(n / Capacity + (to - from))
+ */
+template <class T, int Capacity>
+void UnrolledLinkedList<T, Capacity>::deleteRange(int from, int to)
+{
+    if (from < 0 || to >= _size || from > to) { return; }
+
+    this->eraseRange(from, to - from + 1, nullptr);
+}
+
+/* Mover un rango de elementos a una lista nueva
+ * Complejidad: O(n / Capacity + (to - from))
+ */
+template <class T, int Capacity>
+UnrolledLinkedList<T, Capacity> * UnrolledLinkedList<T, Capacity>::subList(int from, int to)
+{
+    if (from < 0 || to >= _size || from > to) { return nullptr; }
+
+    UnrolledLinkedList * list = new UnrolledLinkedList();
+
+    this->eraseRange(from, to - from + 1, list);
+
+    return list;
+}
+
+/* Contar las ocurrencias de los valores de la lista
+ * Complejidad: O(n) esperado
+ */
+template <class T, int Capacity>
+ValueCounter<T> UnrolledLinkedList<T, Capacity>::countValues() const
+{
+    ValueCounter<T> counter(_size);
+
+    for (const T & value : *this) {
+        counter.add(value);
+    }
+
+    counter.finish();
+
+    return counter;
+}
+
+/* Obtener la unión de dos listas
+ * Complejidad: O(n + m) esperado
+ */
+template <class T, int Capacity>
+UnrolledLinkedList<T, Capacity> * UnrolledLinkedList<T, Capacity>::Union(UnrolledLinkedList * listB, SetSemantics semantics) const
+{
+    UnrolledLinkedList * newList = this->clone();
+
+    ValueCounter<T> inB = listB->countValues();
+
+    if (semantics == SetSemantics::Multiset) {
+        for (const T & value : *this) { inB.take(value); }
+
+        for (const T & value : *listB) {
+            if (inB.take(value)) { newList->insert_back(value); }
+        }
+
+        return newList;
+    }
+
+    ValueCounter<T> inA = this->countValues();
+
+    for (const T & value : *listB) {
+        if (!inA.contains(value) && inB.contains(value)) {
+            newList->insert_back(value);
+            while (inB.take(value)) { }
+        }
+    }
+
+    return newList;
+}
+
+/* Obtener la intersección de dos listas
+ * Complejidad: O(n + m) esperado
+ */
+template <class T, int Capacity>
+UnrolledLinkedList<T, Capacity> * UnrolledLinkedList<T, Capacity>::Intersection(UnrolledLinkedList * listB, SetSemantics semantics) const
+{
+    UnrolledLinkedList * newList = new UnrolledLinkedList();
+
+    ValueCounter<T> inB = listB->countValues();
+
+    for (const T & value : *this) {
+        bool common = semantics == SetSemantics::Multiset ? inB.take(value) : inB.contains(value);
+        if (common) { newList->insert_back(value); }
+    }
+
+    return newList;
+}
+
+/* Obtener la diferencia de dos listas
+ * Complejidad: O(n + m) esperado
+ */
+template <class T, int Capacity>
+UnrolledLinkedList<T, Capacity> * UnrolledLinkedList<T, Capacity>::Except(UnrolledLinkedList * listB, SetSemantics semantics) const
+{
+    UnrolledLinkedList * newList = new UnrolledLinkedList();
+
+    ValueCounter<T> inB = listB->countValues();
+
+    for (const T & value : *this) {
+        bool removed = semantics == SetSemantics::Multiset ? inB.take(value) : inB.contains(value);
+        if (!removed) { newList->insert_back(value); }
+    }
+
+    return newList;
+}
+
+#endif /* UnrolledLinkedList_hpp */
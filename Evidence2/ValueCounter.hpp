@@ -0,0 +1,234 @@
+//
+//  ValueCounter.hpp
+//  LinkedList
+//
+//  Created by Developer on 18/10/26.
+//
+
+#ifndef ValueCounter_hpp
+#define ValueCounter_hpp
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+
+/* Determinar si T se puede usar con std::hash */
+template <class T, class = void>
+struct is_hashable : std::false_type {};
+
+template <class T>
+struct is_hashable<T, std::void_t<decltype(std::hash<T>{}(std::declval<const T &>()))>> : std::true_type {};
+
+/* Determinar si T tiene operator < */
+template <class T, class = void>
+struct is_less_comparable : std::false_type {};
+
+template <class T>
+struct is_less_comparable<T, std::void_t<decltype(std::declval<const T &>() < std::declval<const T &>())>> : std::true_type {};
+
+/* Contadores de valores temporales para las operaciones de conjuntos.
+ * Los tres tienen la misma interfaz:
+ *   add(value)      agrega una ocurrencia
+ *   finish()        se llama una vez después de agregar y antes de consultar
+ *   contains(value) indica si quedan ocurrencias del valor
+ *   take(value)     consume una ocurrencia; regresa false si no quedaba ninguna
+ * Los contadores guardan apuntadores a los valores agregados en lugar de
+ * copiarlos, así que esos valores deben vivir mientras se use el contador.
+ */
+
+/* Tabla hash con direccionamiento abierto (sondeo lineal)
+ * La tabla solo guarda índices a un arreglo denso de valores distintos,
+ * así que sondear recorre enteros contiguos.
+ * Complejidad: O(1) esperado por operación
+ */
+template <class T>
+class HashCounter {
+    std::vector<const T *> values;
+    std::vector<int> counts;
+    std::vector<std::size_t> hashes;
+    std::vector<int> slots;
+    std::size_t mask = 0;
+
+    /* Obtener la ranura del valor, o la ranura vacía donde iría */
+    std::size_t probe(const T & value, std::size_t hash) const
+    {
+        std::size_t slot = hash & mask;
+
+        while (slots[slot] != -1) {
+            int i = slots[slot];
+            if (hashes[i] == hash && *values[i] == value) { break; }
+            slot = (slot + 1) & mask;
+        }
+
+        return slot;
+    }
+
+    void grow()
+    {
+        std::size_t capacity = slots.empty() ? 16 : slots.size() * 2;
+        slots.assign(capacity, -1);
+        mask = capacity - 1;
+
+        for (int i = 0; i < (int) values.size(); ++i) {
+            std::size_t slot = hashes[i] & mask;
+            while (slots[slot] != -1) { slot = (slot + 1) & mask; }
+            slots[slot] = i;
+        }
+    }
+
+public:
+    HashCounter(std::size_t expected = 0)
+    {
+        std::size_t capacity = 16;
+        while (capacity < expected * 2) { capacity *= 2; }
+
+        slots.assign(capacity, -1);
+        mask = capacity - 1;
+        values.reserve(expected);
+        counts.reserve(expected);
+        hashes.reserve(expected);
+    }
+
+    void add(const T & value)
+    {
+        std::size_t hash = std::hash<T>{}(value);
+        std::size_t slot = probe(value, hash);
+
+        if (slots[slot] != -1) {
+            ++counts[slots[slot]];
+            return;
+        }
+
+        slots[slot] = (int) values.size();
+        values.push_back(&value);
+        counts.push_back(1);
+        hashes.push_back(hash);
+
+        /* Mantener el factor de carga por debajo de 1/2 */
+        if (values.size() * 2 > slots.size()) { grow(); }
+    }
+
+    void finish() {}
+
+    bool contains(const T & value) const
+    {
+        int i = slots[probe(value, std::hash<T>{}(value))];
+        return i != -1 && counts[i] > 0;
+    }
+
+    bool take(const T & value)
+    {
+        int i = slots[probe(value, std::hash<T>{}(value))];
+        if (i == -1 || counts[i] == 0) { return false; }
+
+        --counts[i];
+        return true;
+    }
+};
+
+/* Arreglo ordenado de (valor, ocurrencias) para tipos sin hash pero con <
+ * Complejidad: O(m log m) para construir, O(log m) por consulta
+ */
+template <class T>
+class SortedCounter {
+    std::vector< std::pair<const T *, int> > entries;
+
+    typename std::vector< std::pair<const T *, int> >::iterator find(const T & value)
+    {
+        auto it = std::lower_bound(entries.begin(), entries.end(), value,
+                                   [](const std::pair<const T *, int> & e, const T & v) { return *e.first < v; });
+
+        return (it != entries.end() && !(value < *it->first)) ? it : entries.end();
+    }
+
+public:
+    SortedCounter(std::size_t expected = 0) { entries.reserve(expected); }
+
+    void add(const T & value) { entries.push_back({ &value, 1 }); }
+
+    /* Ordenar y juntar los valores repetidos */
+    void finish()
+    {
+        std::stable_sort(entries.begin(), entries.end(),
+                         [](const std::pair<const T *, int> & a, const std::pair<const T *, int> & b) { return *a.first < *b.first; });
+
+        std::size_t out = 0;
+        for (std::size_t i = 0; i < entries.size(); ++i) {
+            if (out > 0 && !(*entries[out-1].first < *entries[i].first)) {
+                ++entries[out-1].second;
+            }
+            else {
+                entries[out++] = entries[i];
+            }
+        }
+        entries.erase(entries.begin() + out, entries.end());
+    }
+
+    bool contains(const T & value)
+    {
+        auto it = find(value);
+        return it != entries.end() && it->second > 0;
+    }
+
+    bool take(const T & value)
+    {
+        auto it = find(value);
+        if (it == entries.end() || it->second == 0) { return false; }
+
+        --it->second;
+        return true;
+    }
+};
+
+/* Búsqueda lineal para tipos que solo tienen ==
+ * Complejidad: O(m) por consulta
+ */
+template <class T>
+class LinearCounter {
+    std::vector< std::pair<const T *, int> > entries;
+
+    std::pair<const T *, int> * find(const T & value)
+    {
+        for (auto & e : entries) {
+            if (*e.first == value) { return &e; }
+        }
+        return nullptr;
+    }
+
+public:
+    LinearCounter(std::size_t = 0) {}
+
+    void add(const T & value)
+    {
+        auto e = find(value);
+        if (e) { ++e->second; }
+        else { entries.push_back({ &value, 1 }); }
+    }
+
+    void finish() {}
+
+    bool contains(const T & value)
+    {
+        auto e = find(value);
+        return e != nullptr && e->second > 0;
+    }
+
+    bool take(const T & value)
+    {
+        auto e = find(value);
+        if (e == nullptr || e->second == 0) { return false; }
+
+        --e->second;
+        return true;
+    }
+};
+
+/* Elegir el contador más rápido que admite T */
+template <class T>
+using ValueCounter = typename std::conditional< is_hashable<T>::value, HashCounter<T>,
+                     typename std::conditional< is_less_comparable<T>::value, SortedCounter<T>,
+                                                LinearCounter<T> >::type >::type;
+
+#endif /* ValueCounter_hpp */